@@ -0,0 +1,475 @@
+#include "ReflectPch.h"
+#include "Reflect/Dispatch.h"
+
+#include "Platform/Atomic.h"
+#include "Platform/Condition.h"
+#include "Platform/Locks.h"
+#include "Platform/Thread.h"
+
+#include "Reflect/Exceptions.h"
+#include "Reflect/Object.h"
+
+#include <algorithm>
+
+using namespace Helium;
+using namespace Helium::Reflect;
+
+// objects a thread takes from its own share at a time, so the share lock isn't taken per call
+static const size_t DispatchBatchSize = 16;
+
+// the unclaimed part of a thread's share, the owner takes from the front and thieves take from the back
+struct DispatchShare
+{
+	Mutex  m_Lock;
+	size_t m_Begin;
+	size_t m_End;
+};
+
+struct DispatchState
+{
+	const Method*                m_Method;
+	Object* const*               m_Objects;
+	const ArgumentFrame*         m_Argument;
+	uint32_t                     m_Flags;
+	uint32_t                     m_ThreadCount;
+	DispatchShare*               m_Shares;
+	Mutex                        m_ErrorLock;
+	DynamicArray< MethodError >* m_Errors;
+};
+
+struct DispatchRangeState
+{
+	ParallelRangeFunc m_Function;
+	void*             m_Context;
+	uint32_t          m_ThreadCount;
+	DispatchShare*    m_Shares;
+	Mutex             m_ErrorLock;
+	volatile int32_t  m_Failed;
+	String            m_Error;
+};
+
+typedef void (*DispatchWorkerFunc)( void* state, uint32_t index );
+
+struct DispatchPool;
+
+// a thread kept between dispatches, woken for each dispatch it takes part in
+struct DispatchThread
+{
+	CallbackThread m_Thread;
+	Condition      m_Wake;
+	DispatchPool*  m_Pool;
+	uint32_t       m_Index;
+};
+
+// the threads kept for dispatching, used by one dispatch at a time
+struct DispatchPool
+{
+	DynamicArray< DispatchThread* > m_Threads;
+	DispatchWorkerFunc              m_Function;
+	void*                           m_State;
+	volatile int32_t                m_Pending;
+	Condition                       m_Done;
+	bool                            m_Exit;
+};
+
+static Mutex              g_DispatchPoolLock;   // held by the dispatch using the pool
+static DispatchPool*      g_DispatchPool = NULL;
+static ThreadLocalPointer g_DispatchRunning;    // set while a thread runs dispatch work, so dispatches nested in it run inline
+
+MethodError::MethodError()
+	: m_Index( 0 )
+{
+}
+
+MethodError::MethodError( size_t index, const char* message )
+	: m_Index( index )
+	, m_Message( message )
+{
+}
+
+static const char* UnknownExceptionMessage = TXT( "Unknown exception" );
+
+static bool SortMethodErrors( const MethodError& left, const MethodError& right )
+{
+	return left.m_Index < right.m_Index;
+}
+
+static bool TakeOwnWork( DispatchShare& share, size_t& begin, size_t& end )
+{
+	MutexScopeLock lock ( share.m_Lock );
+	if ( share.m_Begin == share.m_End )
+	{
+		return false;
+	}
+
+	begin = share.m_Begin;
+	end = std::min( share.m_Begin + DispatchBatchSize, share.m_End );
+	share.m_Begin = end;
+	return true;
+}
+
+// move the back half of another thread's remaining share into ours
+static bool StealWork( DispatchShare* shares, uint32_t threadCount, uint32_t index )
+{
+	for ( uint32_t i=1; i<threadCount; ++i )
+	{
+		DispatchShare& victim = shares[ ( index + i ) % threadCount ];
+
+		size_t begin, end;
+		{
+			MutexScopeLock lock ( victim.m_Lock );
+			size_t remaining = victim.m_End - victim.m_Begin;
+			if ( remaining == 0 )
+			{
+				continue;
+			}
+
+			begin = victim.m_Begin + remaining / 2;
+			end = victim.m_End;
+			victim.m_End = begin;
+		}
+
+		DispatchShare& share = shares[ index ];
+		MutexScopeLock lock ( share.m_Lock );
+		share.m_Begin = begin;
+		share.m_End = end;
+		return true;
+	}
+
+	return false;
+}
+
+static void RestoreArgument( DispatchState& state, ArgumentFrame& frame )
+{
+	if ( state.m_Argument )
+	{
+		frame.m_Translator->Copy( *state.m_Argument, frame, 0 );
+	}
+	else
+	{
+		frame.Reset();
+	}
+}
+
+static void AddMethodError( DispatchState& state, size_t index, const char* message )
+{
+	if ( state.m_Errors )
+	{
+		MutexScopeLock lock ( state.m_ErrorLock );
+		state.m_Errors->Add( MethodError( index, message ) );
+	}
+}
+
+static bool TakeWork( DispatchShare* shares, uint32_t threadCount, uint32_t index, size_t& begin, size_t& end )
+{
+	return TakeOwnWork( shares[ index ], begin, end ) || ( StealWork( shares, threadCount, index ) && TakeOwnWork( shares[ index ], begin, end ) );
+}
+
+static void RunDispatchCalls( DispatchState& state, uint32_t index, ArgumentFrame& frame )
+{
+	// the frame is restored before the first call, and before every call after it with ResetArgument
+	bool restore = state.m_Argument != NULL;
+	size_t begin, end;
+	while ( TakeWork( state.m_Shares, state.m_ThreadCount, index, begin, end ) )
+	{
+		for ( size_t i=begin; i<end; ++i )
+		{
+			try
+			{
+				if ( restore )
+				{
+					RestoreArgument( state, frame );
+				}
+				restore = ( state.m_Flags & DispatchFlags::ResetArgument ) != 0;
+
+				state.m_Method->Invoke( state.m_Objects[ i ], frame );
+			}
+			catch ( const Helium::Exception& ex )
+			{
+				AddMethodError( state, i, ex.What() );
+			}
+			catch ( ... )
+			{
+				AddMethodError( state, i, UnknownExceptionMessage );
+			}
+		}
+	}
+}
+
+// a thread that can't construct its frame fails every call it takes
+static void FailDispatchCalls( DispatchState& state, uint32_t index, const char* message )
+{
+	size_t begin, end;
+	while ( TakeWork( state.m_Shares, state.m_ThreadCount, index, begin, end ) )
+	{
+		for ( size_t i=begin; i<end; ++i )
+		{
+			AddMethodError( state, i, message );
+		}
+	}
+}
+
+static void RunDispatch( void* param, uint32_t index )
+{
+	DispatchState& state = *static_cast< DispatchState* >( param );
+
+	try
+	{
+		ArgumentFrame frame ( *state.m_Method );
+		RunDispatchCalls( state, index, frame );
+	}
+	catch ( const Helium::Exception& ex )
+	{
+		FailDispatchCalls( state, index, ex.What() );
+	}
+	catch ( ... )
+	{
+		FailDispatchCalls( state, index, UnknownExceptionMessage );
+	}
+}
+
+// the first error stops every thread of the range
+static void FailDispatchRange( DispatchRangeState& state, const char* message )
+{
+	MutexScopeLock lock ( state.m_ErrorLock );
+	if ( !state.m_Failed )
+	{
+		state.m_Error = message;
+		state.m_Failed = 1;
+	}
+}
+
+static void RunDispatchRange( void* param, uint32_t index )
+{
+	DispatchRangeState& state = *static_cast< DispatchRangeState* >( param );
+
+	size_t begin, end;
+	while ( !state.m_Failed && TakeWork( state.m_Shares, state.m_ThreadCount, index, begin, end ) )
+	{
+		try
+		{
+			state.m_Function( state.m_Context, begin, end );
+		}
+		catch ( const Helium::Exception& ex )
+		{
+			FailDispatchRange( state, ex.What() );
+		}
+		catch ( ... )
+		{
+			FailDispatchRange( state, UnknownExceptionMessage );
+		}
+	}
+}
+
+static void DispatchThreadEntry( void* param )
+{
+	DispatchThread* thread = static_cast< DispatchThread* >( param );
+	DispatchPool* pool = thread->m_Pool;
+	g_DispatchRunning.SetPointer( thread );
+
+	for (;;)
+	{
+		thread->m_Wake.Wait();
+		if ( pool->m_Exit )
+		{
+			break;
+		}
+
+		pool->m_Function( pool->m_State, thread->m_Index );
+
+		if ( AtomicDecrementRelease( pool->m_Pending ) == 0 )
+		{
+			pool->m_Done.Signal();
+		}
+	}
+
+	// pool threads end here, so give back the variable storage, object slots and proxies they cached
+	Variable::ReleaseThreadPool();
+	ObjectSlab::ReleaseThreadCache();
+	ObjectRefCountSupport::ReleaseThreadCache();
+}
+
+// wakes pool threads for one dispatch, and waits for them however the calling thread leaves the dispatch
+class DispatchPoolScope : NonCopyable
+{
+public:
+	DispatchPoolScope( DispatchPool& pool, DispatchWorkerFunc function, void* state, uint32_t threadCount )
+		: m_Pool( pool )
+		, m_Count( 0 )
+	{
+		while ( pool.m_Threads.GetSize() < threadCount - 1 )
+		{
+			DispatchThread* thread = new DispatchThread;
+			thread->m_Pool = &pool;
+			thread->m_Index = static_cast< uint32_t >( pool.m_Threads.GetSize() + 1 );
+			if ( !thread->m_Thread.Create( &DispatchThreadEntry, thread, TXT( "Reflect Dispatch" ) ) )
+			{
+				delete thread;
+				break;
+			}
+			pool.m_Threads.Add( thread );
+		}
+
+		m_Count = std::min( threadCount - 1, static_cast< uint32_t >( pool.m_Threads.GetSize() ) );
+		pool.m_Function = function;
+		pool.m_State = state;
+		pool.m_Pending = static_cast< int32_t >( m_Count );
+		for ( uint32_t i=0; i<m_Count; ++i )
+		{
+			pool.m_Threads[ i ]->m_Wake.Signal();
+		}
+
+		g_DispatchRunning.SetPointer( &pool );
+	}
+
+	~DispatchPoolScope()
+	{
+		if ( m_Count )
+		{
+			m_Pool.m_Done.Wait();
+		}
+
+		g_DispatchRunning.SetPointer( NULL );
+	}
+
+private:
+	DispatchPool& m_Pool;
+	uint32_t      m_Count;
+};
+
+// an even share of the range for each thread, freed however the dispatch ends
+class DispatchShares : NonCopyable
+{
+public:
+	DispatchShares( size_t count, uint32_t threadCount )
+		: m_Shares( new DispatchShare[ threadCount ] )
+	{
+		for ( uint32_t i=0; i<threadCount; ++i )
+		{
+			m_Shares[ i ].m_Begin = count * i / threadCount;
+			m_Shares[ i ].m_End = count * ( i + 1 ) / threadCount;
+		}
+	}
+
+	~DispatchShares()
+	{
+		delete[] m_Shares;
+	}
+
+	DispatchShare* Get() const
+	{
+		return m_Shares;
+	}
+
+private:
+	DispatchShare* m_Shares;
+};
+
+// the calling thread is worker zero and the rest come from the pool, started on first use
+//  the shares of threads that fail to start, and of every thread of a dispatch nested in another, are stolen by worker zero
+static void RunWorkers( DispatchWorkerFunc function, void* state, uint32_t threadCount )
+{
+	if ( threadCount > 1 && !g_DispatchRunning.GetPointer() )
+	{
+		MutexScopeLock lock ( g_DispatchPoolLock );
+		if ( !g_DispatchPool )
+		{
+			g_DispatchPool = new DispatchPool;
+			g_DispatchPool->m_Function = NULL;
+			g_DispatchPool->m_State = NULL;
+			g_DispatchPool->m_Pending = 0;
+			g_DispatchPool->m_Exit = false;
+		}
+
+		DispatchPoolScope scope ( *g_DispatchPool, function, state, threadCount );
+		function( state, 0 );
+		return;
+	}
+
+	function( state, 0 );
+}
+
+static uint32_t ClampThreadCount( size_t count, uint32_t threadCount )
+{
+	if ( threadCount < 1 )
+	{
+		threadCount = 1;
+	}
+
+	if ( count < threadCount )
+	{
+		threadCount = count ? static_cast< uint32_t >( count ) : 1;
+	}
+
+	return threadCount;
+}
+
+void Reflect::InvokeParallel( const Method& method, Object* const* objects, size_t count, uint32_t threadCount, const ArgumentFrame* argument, uint32_t flags, DynamicArray< MethodError >* errors )
+{
+	HELIUM_ASSERT( !argument || argument->m_Method == &method );
+
+	size_t firstError = errors ? errors->GetSize() : 0;
+
+	threadCount = ClampThreadCount( count, threadCount );
+
+	DispatchState state;
+	state.m_Method = &method;
+	state.m_Objects = objects;
+	state.m_Argument = argument;
+	state.m_Flags = flags;
+	state.m_ThreadCount = threadCount;
+	DispatchShares shares ( count, threadCount );
+	state.m_Shares = shares.Get();
+	state.m_Errors = errors;
+
+	RunWorkers( &RunDispatch, &state, threadCount );
+
+	if ( errors && errors->GetSize() > firstError )
+	{
+		std::sort( errors->GetData() + firstError, errors->GetData() + errors->GetSize(), &SortMethodErrors );
+	}
+}
+
+void Reflect::ForEachParallel( size_t count, uint32_t threadCount, ParallelRangeFunc function, void* context )
+{
+	threadCount = ClampThreadCount( count, threadCount );
+
+	DispatchRangeState state;
+	state.m_Function = function;
+	state.m_Context = context;
+	state.m_ThreadCount = threadCount;
+	DispatchShares shares ( count, threadCount );
+	state.m_Shares = shares.Get();
+	state.m_Failed = 0;
+
+	RunWorkers( &RunDispatchRange, &state, threadCount );
+
+	if ( state.m_Failed )
+	{
+		throw Reflect::Exception( TXT( "%s" ), state.m_Error.GetData() );
+	}
+}
+
+void Reflect::ReleaseDispatchThreads()
+{
+	MutexScopeLock lock ( g_DispatchPoolLock );
+	DispatchPool* pool = g_DispatchPool;
+	if ( !pool )
+	{
+		return;
+	}
+
+	pool->m_Exit = true;
+	for ( size_t i=0; i<pool->m_Threads.GetSize(); ++i )
+	{
+		pool->m_Threads[ i ]->m_Wake.Signal();
+	}
+	for ( size_t i=0; i<pool->m_Threads.GetSize(); ++i )
+	{
+		pool->m_Threads[ i ]->m_Thread.Join();
+		delete pool->m_Threads[ i ];
+	}
+
+	delete pool;
+	g_DispatchPool = NULL;
+}
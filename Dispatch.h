@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Foundation/DynamicArray.h"
+#include "Foundation/String.h"
+
+#include "Reflect/MetaStruct.h"
+
+namespace Helium
+{
+	namespace Reflect
+	{
+		class Object;
+
+		namespace DispatchFlags
+		{
+			enum MetaType
+			{
+				ResetArgument = 1 << 0, // restore the argument before every call, not just once per thread
+			};
+		}
+
+		//
+		// MethodError (an exception thrown by one call of a dispatch)
+		//
+
+		struct HELIUM_REFLECT_API MethodError
+		{
+			MethodError();
+			MethodError( size_t index, const char* message );
+
+			size_t m_Index;   // index of the object in the dispatched range
+			String m_Message; // the exception message ("Unknown exception" for exceptions not derived from Helium::Exception)
+		};
+
+		//
+		// Calls a method on every object of a range using threadCount threads (the calling thread and threads kept between calls)
+		//  each thread starts with an even share of the range and steals from the others once its share runs out
+		//  each thread has its own argument frame, copied from argument (or default constructed) when the thread starts
+		//  errors are reported sorted by object index, independent of scheduling (failing to construct or restore an
+		//   argument frame is reported as the error of each call that would have used it)
+		//
+
+		HELIUM_REFLECT_API void InvokeParallel( const Method& method, Object* const* objects, size_t count, uint32_t threadCount, const ArgumentFrame* argument = NULL, uint32_t flags = 0, DynamicArray< MethodError >* errors = NULL );
+
+		//
+		// Calls a function on batches of a range of indices using threadCount threads, scheduled like InvokeParallel
+		//  the function is called from several threads at once, each call covering [begin, end)
+		//  an exception thrown by the function stops the range, and the first is thrown again from here as a Reflect::Exception
+		//
+
+		typedef void (*ParallelRangeFunc)( void* context, size_t begin, size_t end );
+
+		HELIUM_REFLECT_API void ForEachParallel( size_t count, uint32_t threadCount, ParallelRangeFunc function, void* context );
+
+		//
+		// Stops the threads kept for parallel calls (Reflect::Cleanup does, they are started again when next needed)
+		//
+
+		HELIUM_REFLECT_API void ReleaseDispatchThreads();
+	}
+}
@@ -1,6 +1,15 @@
 #include "ReflectPch.h"
 #include "Reflect/Meta.h"
 
+#include "Platform/Atomic.h"
+#include "Platform/Locks.h"
+#include "Platform/Thread.h"
+
+#include "Foundation/Crc32.h"
+
+#include <errno.h>
+#include <map>
+
 using namespace Helium;
 using namespace Helium::Reflect;
 
@@ -19,6 +28,453 @@ const char* MetaIds::Strings[ MetaIds::Count ] =
 
 HELIUM_COMPILE_ASSERT( sizeof( MetaIds::Strings ) / sizeof( MetaIds::Strings[0] ) == MetaIds::Count );
 
+// serializes property writers, readers never lock
+static Mutex g_PropertyWriteLock;
+
+// every write advances the epoch, a block replaced in an epoch can only be seen by readers that entered in it or before
+static volatile int32_t g_PropertyEpoch = 1;
+
+// the epoch each reading thread entered its outermost PropertyReadScope at, on a cache line of its own
+//  readers are never freed, those of exited threads are taken over by new ones
+struct HELIUM_ALIGN_PRE( 64 ) Helium::Reflect::PropertyReader
+{
+	volatile int32_t m_Epoch;  // zero outside a PropertyReadScope
+	uint32_t         m_Depth;  // of nested scopes, only touched by the owning thread
+	volatile int32_t m_Free;   // set once the owning thread exits
+	PropertyReader*  m_Next;
+} HELIUM_ALIGN_POST( 64 );
+
+static PropertyReader* volatile g_PropertyReaders = NULL;
+
+static void ReleasePropertyReader( void* reader )
+{
+	AtomicExchangeRelease( static_cast< PropertyReader* >( reader )->m_Free, 1 );
+}
+
+static ThreadLocalPointer g_PropertyReader ( &ReleasePropertyReader );
+
+static PropertyReader* GetPropertyReader()
+{
+	PropertyReader* reader = static_cast< PropertyReader* >( g_PropertyReader.GetPointer() );
+	if ( reader )
+	{
+		return reader;
+	}
+
+	for ( PropertyReader* exited = AtomicLoadAcquire( g_PropertyReaders ); exited; exited = exited->m_Next )
+	{
+		if ( exited->m_Free && AtomicCompareExchangeAcquire( exited->m_Free, 0, 1 ) == 1 )
+		{
+			reader = exited;
+			break;
+		}
+	}
+
+	if ( !reader )
+	{
+		DefaultAllocator allocator;
+		reader = static_cast< PropertyReader* >( allocator.AllocateAligned( 64, sizeof( PropertyReader ) ) );
+		HELIUM_ASSERT( reader );
+		reader->m_Epoch = 0;
+		reader->m_Depth = 0;
+		reader->m_Free = 0;
+
+		PropertyReader* head;
+		do
+		{
+			head = g_PropertyReaders;
+			reader->m_Next = head;
+		}
+		while ( AtomicCompareExchangeRelease( g_PropertyReaders, reader, head ) != head );
+	}
+
+	g_PropertyReader.SetPointer( reader );
+	return reader;
+}
+
+PropertyCollection::PropertyBlock* PropertyCollection::s_RetiredBlocks = NULL;
+
+PropertyKey::PropertyKey( const char* name )
+	: m_Name( name )
+	, m_Hash( Crc32( name ) )
+{
+}
+
+PropertyKey::PropertyKey( const std::string& name )
+	: m_Interned( name.c_str() )
+	, m_Name( m_Interned.Get() )
+	, m_Hash( Crc32( name.c_str() ) )
+{
+}
+
+PropertyValue::PropertyValue()
+	: m_Flags( 0 )
+	, m_Integer( 0 )
+	, m_Float( 0.0 )
+	, m_Boolean( false )
+{
+}
+
+void PropertyValue::SetInteger( int64_t value )
+{
+	m_Flags = PropertyFlags::Integer | PropertyFlags::Float;
+	m_Integer = value;
+	m_Float = static_cast< float64_t >( value );
+	if ( value == 0 || value == 1 )
+	{
+		m_Flags |= PropertyFlags::Boolean;
+		m_Boolean = value != 0;
+	}
+
+	std::ostringstream str;
+	str << value;
+	m_String = str.str();
+}
+
+void PropertyValue::SetUnsigned( uint64_t value )
+{
+	if ( value <= static_cast< uint64_t >( INT64_MAX ) )
+	{
+		SetInteger( static_cast< int64_t >( value ) );
+		return;
+	}
+
+	m_Flags = PropertyFlags::Unsigned | PropertyFlags::Float;
+	m_Integer = static_cast< int64_t >( value );
+	m_Float = static_cast< float64_t >( value );
+
+	std::ostringstream str;
+	str << value;
+	m_String = str.str();
+}
+
+void PropertyValue::SetFloat( float64_t value )
+{
+	m_Flags = PropertyFlags::Float;
+	m_Float = value;
+
+	std::ostringstream str;
+	str.precision( 17 );
+	str << value;
+	m_String = str.str();
+}
+
+void PropertyValue::SetBoolean( bool value )
+{
+	m_Flags = PropertyFlags::Integer | PropertyFlags::Float | PropertyFlags::Boolean;
+	m_Integer = value ? 1 : 0;
+	m_Float = value ? 1.0 : 0.0;
+	m_Boolean = value;
+	m_String = value ? "1" : "0";
+}
+
+void PropertyValue::SetString( const std::string& value )
+{
+	m_Flags = 0;
+	m_String = value;
+
+	const char* begin = value.c_str();
+	char* end = NULL;
+
+	if ( !value.empty() )
+	{
+		errno = 0;
+		int64_t integer = strtoll( begin, &end, 10 );
+		if ( *end == '\0' && errno == 0 )
+		{
+			m_Flags |= PropertyFlags::Integer;
+			m_Integer = integer;
+		}
+		else if ( *end == '\0' && errno == ERANGE && *begin != '-' )
+		{
+			errno = 0;
+			uint64_t unsignedInteger = strtoull( begin, &end, 10 );
+			if ( *end == '\0' && errno == 0 )
+			{
+				m_Flags |= PropertyFlags::Unsigned;
+				m_Integer = static_cast< int64_t >( unsignedInteger );
+			}
+		}
+
+		float64_t floating = strtod( begin, &end );
+		if ( *end == '\0' )
+		{
+			m_Flags |= PropertyFlags::Float;
+			m_Float = floating;
+		}
+	}
+
+	if ( value == "1" || value == "true" )
+	{
+		m_Flags |= PropertyFlags::Boolean;
+		m_Boolean = true;
+	}
+	else if ( value == "0" || value == "false" )
+	{
+		m_Flags |= PropertyFlags::Boolean;
+		m_Boolean = false;
+	}
+}
+
+PropertyReadScope::PropertyReadScope()
+	: m_Reader( GetPropertyReader() )
+{
+	// the exchange is a full barrier, so either a write scanning the readers sees this epoch,
+	//  or the blocks loaded after it are the ones that write published
+	if ( m_Reader->m_Depth++ == 0 )
+	{
+		AtomicExchangeAcquire( m_Reader->m_Epoch, AtomicLoadAcquire( g_PropertyEpoch ) );
+	}
+}
+
+PropertyReadScope::~PropertyReadScope()
+{
+	if ( --m_Reader->m_Depth == 0 )
+	{
+		AtomicExchangeRelease( m_Reader->m_Epoch, 0 );
+	}
+}
+
+PropertyFootprint::PropertyFootprint()
+	: m_Collections( 0 )
+	, m_Properties( 0 )
+	, m_Bytes( 0 )
+	, m_MapBytes( 0 )
+{
+}
+
+PropertyCollection::PropertyCollection( const PropertyCollection& rhs )
+	: m_Properties( NULL )
+{
+	*this = rhs;
+}
+
+PropertyCollection::~PropertyCollection()
+{
+	// nothing can be reading a collection being destroyed, so its block is freed directly
+	if ( m_Properties )
+	{
+		FreeBlock( m_Properties );
+	}
+}
+
+PropertyCollection& PropertyCollection::operator=( const PropertyCollection& rhs )
+{
+	if ( this != &rhs )
+	{
+		// blocks are only freed under the write lock, so the source needs no read scope
+		MutexScopeLock lock ( g_PropertyWriteLock );
+
+		PropertyBlock* block = NULL;
+		PropertyBlock* source = rhs.LoadProperties();
+		if ( source )
+		{
+			block = static_cast< PropertyBlock* >( ::operator new( sizeof( PropertyBlock ) + source->m_Count * sizeof( Property ) ) );
+			block->m_Count = source->m_Count;
+			block->m_RetiredEpoch = 0;
+			block->m_NextRetired = NULL;
+
+			Property* sourceProperties = source->GetProperties();
+			Property* properties = block->GetProperties();
+			for ( uint32_t i=0; i<source->m_Count; ++i )
+			{
+				new ( &properties[ i ] ) Property( sourceProperties[ i ] );
+			}
+		}
+
+		RetireBlock( AtomicExchangeRelease( m_Properties, block ) );
+	}
+
+	return *this;
+}
+
+const PropertyValue* PropertyCollection::FindPropertyValue( const PropertyKey& key ) const
+{
+	// blocks are immutable once published, so a reader only needs the pointer
+	const Property* property = FindProperty( LoadProperties(), key );
+	return property ? &property->m_Value : NULL;
+}
+
+// heap bytes of a std::string, zero while it fits the small string buffer
+static size_t GetStringHeapBytes( size_t length )
+{
+	return length >= sizeof( std::string ) - 1 ? length + 1 : 0;
+}
+
+void PropertyCollection::AccumulateFootprint( PropertyFootprint& footprint ) const
+{
+	++footprint.m_Collections;
+	footprint.m_Bytes += sizeof( PropertyCollection );
+	footprint.m_MapBytes += sizeof( std::map< std::string, std::string > );
+
+	PropertyReadScope scope;
+	PropertyBlock* current = LoadProperties();
+	if ( !current )
+	{
+		return;
+	}
+
+	footprint.m_Properties += current->m_Count;
+	footprint.m_Bytes += sizeof( PropertyBlock ) + current->m_Count * sizeof( Property );
+
+	// a map node is three links and a color ahead of the key/value pair, each key its own copy
+	const Property* properties = current->GetProperties();
+	for ( uint32_t i=0; i<current->m_Count; ++i )
+	{
+		size_t value = GetStringHeapBytes( properties[ i ].m_Value.m_String.length() );
+		footprint.m_Bytes += value;
+		footprint.m_MapBytes += 4 * sizeof( void* ) + 2 * sizeof( std::string ) + GetStringHeapBytes( strlen( properties[ i ].m_Key.Get() ) ) + value;
+	}
+}
+
+PropertyCollection::PropertyBlock* PropertyCollection::LoadProperties() const
+{
+	return AtomicLoadAcquire( m_Properties );
+}
+
+uint32_t PropertyCollection::LowerBound( PropertyBlock* block, uint32_t hash )
+{
+	const Property* properties = block->GetProperties();
+
+	uint32_t first = 0;
+	uint32_t count = block->m_Count;
+	while ( count > 0 )
+	{
+		uint32_t step = count / 2;
+		if ( properties[ first + step ].m_KeyHash < hash )
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+	return first;
+}
+
+const PropertyCollection::Property* PropertyCollection::FindProperty( PropertyBlock* block, const PropertyKey& key )
+{
+	if ( !block )
+	{
+		return NULL;
+	}
+
+	const Property* properties = block->GetProperties();
+	for ( uint32_t index = LowerBound( block, key.m_Hash ); index < block->m_Count && properties[ index ].m_KeyHash == key.m_Hash; ++index )
+	{
+		if ( strcmp( properties[ index ].m_Key.Get(), key.m_Name ) == 0 )
+		{
+			return &properties[ index ];
+		}
+	}
+
+	return NULL;
+}
+
+void PropertyCollection::SetPropertyValue( const PropertyKey& key, const PropertyValue& value ) const
+{
+	MutexScopeLock lock ( g_PropertyWriteLock );
+
+	PropertyBlock* current = LoadProperties();
+	const Property* found = FindProperty( current, key );
+
+	uint32_t count = current ? current->m_Count : 0;
+	uint32_t index = found ? static_cast< uint32_t >( found - current->GetProperties() ) : ( current ? LowerBound( current, key.m_Hash ) : 0 );
+	uint32_t newCount = found ? count : count + 1;
+
+	// build the replacement block completely before publishing it
+	PropertyBlock* block = static_cast< PropertyBlock* >( ::operator new( sizeof( PropertyBlock ) + newCount * sizeof( Property ) ) );
+	block->m_Count = newCount;
+	block->m_RetiredEpoch = 0;
+	block->m_NextRetired = NULL;
+
+	Property* properties = block->GetProperties();
+	uint32_t source = 0;
+	for ( uint32_t i=0; i<newCount; ++i )
+	{
+		if ( i == index )
+		{
+			Property* property = new ( &properties[ i ] ) Property();
+			property->m_KeyHash = key.m_Hash;
+			property->m_Key.Set( key.m_Name );
+			property->m_Value = value;
+
+			if ( found )
+			{
+				++source;
+			}
+		}
+		else
+		{
+			new ( &properties[ i ] ) Property( current->GetProperties()[ source++ ] );
+		}
+	}
+
+	AtomicExchangeRelease( m_Properties, block );
+	RetireBlock( current );
+}
+
+void PropertyCollection::ClearProperties()
+{
+	MutexScopeLock lock ( g_PropertyWriteLock );
+
+	RetireBlock( AtomicExchangeRelease( m_Properties, static_cast< PropertyBlock* >( NULL ) ) );
+}
+
+void PropertyCollection::RetireBlock( PropertyBlock* block )
+{
+	// the block was unpublished before the epoch advances, so readers entering after it can't see it
+	if ( block )
+	{
+		block->m_RetiredEpoch = g_PropertyEpoch;
+		block->m_NextRetired = s_RetiredBlocks;
+		s_RetiredBlocks = block;
+		AtomicIncrementRelease( g_PropertyEpoch );
+	}
+
+	if ( !s_RetiredBlocks )
+	{
+		return;
+	}
+
+	// the oldest epoch a thread is still reading in
+	int32_t oldest = g_PropertyEpoch;
+	for ( PropertyReader* reader = AtomicLoadAcquire( g_PropertyReaders ); reader; reader = reader->m_Next )
+	{
+		int32_t epoch = AtomicLoadAcquire( reader->m_Epoch );
+		if ( epoch && epoch - oldest < 0 )
+		{
+			oldest = epoch;
+		}
+	}
+
+	PropertyBlock** link = &s_RetiredBlocks;
+	while ( PropertyBlock* retired = *link )
+	{
+		if ( oldest - retired->m_RetiredEpoch > 0 )
+		{
+			*link = retired->m_NextRetired;
+			FreeBlock( retired );
+		}
+		else
+		{
+			link = &retired->m_NextRetired;
+		}
+	}
+}
+
+void PropertyCollection::FreeBlock( PropertyBlock* block )
+{
+	Property* properties = block->GetProperties();
+	for ( uint32_t i=0; i<block->m_Count; ++i )
+	{
+		properties[ i ].~Property();
+	}
+	::operator delete( block );
+}
+
 Meta::Meta()
 {
 
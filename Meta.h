@@ -1,9 +1,12 @@
 #pragma once
 
-#include <map>
+#include <sstream>
+#include <string>
 
 #include "Platform/Types.h"
+#include "Platform/Utility.h"
 
+#include "Foundation/Name.h"
 #include "Foundation/SmartPtr.h"
 
 #include "Reflect/API.h"
@@ -67,22 +70,148 @@ namespace Helium
 		typedef MetaIds::MetaId MetaId;
 
 		//
-		// A block of string-based properties
+		// Property keys carry their hash, so a key built once (eg. static const) is never rehashed
+		//  a key built from a std::string interns it, so it doesn't depend on the string staying alive
 		//
 
-		class HELIUM_REFLECT_API PropertyCollection
+		struct HELIUM_REFLECT_API PropertyKey
 		{
-		protected:
-			mutable std::map< std::string, std::string > m_Properties;
+			PropertyKey( const char* name );
+			PropertyKey( const std::string& name );
+
+			Name        m_Interned; // owns the name of keys built from a std::string
+			const char* m_Name;
+			uint32_t    m_Hash;
+		};
+
+		//
+		// Property values are parsed once when set, into every form the value supports
+		//
+
+		namespace PropertyFlags
+		{
+			enum MetaType
+			{
+				Integer = 1 << 0, // m_Integer holds the value
+				Float   = 1 << 1, // m_Float holds the value
+				Boolean = 1 << 2, // m_Boolean holds the value
+				Unsigned = 1 << 3, // m_Integer holds the bits of an unsigned value too large for int64_t (instead of Integer)
+			};
+		}
+
+		struct HELIUM_REFLECT_API PropertyValue
+		{
+			PropertyValue();
+
+			void SetInteger( int64_t value );
+			void SetUnsigned( uint64_t value );
+			void SetFloat( float64_t value );
+			void SetBoolean( bool value );
+			void SetString( const std::string& value );
+
+			uint32_t    m_Flags;   // the pre-parsed forms that are valid
+			int64_t     m_Integer;
+			float64_t   m_Float;
+			bool        m_Boolean;
+			std::string m_String;  // always valid
+		};
+
+		struct HELIUM_REFLECT_API PropertyFootprint
+		{
+			PropertyFootprint();
+
+			size_t m_Collections; // number of collections accumulated
+			size_t m_Properties;  // number of properties they hold
+			size_t m_Bytes;       // sizeof( PropertyCollection ) and the heap storage of each
+			size_t m_MapBytes;    // estimate for the same string properties in a std::map< std::string, std::string >
+		};
+
+		struct PropertyReader;
+
+		//
+		// Keeps the property blocks read by the calling thread from being freed while it's in scope
+		//  values returned by FindPropertyValue are only valid inside one
+		//  each thread announces the write epoch it entered at in its own reader, so readers share no cache lines
+		//
+
+		class HELIUM_REFLECT_API PropertyReadScope : NonCopyable
+		{
+		public:
+			PropertyReadScope();
+			~PropertyReadScope();
 
+		private:
+			PropertyReader* m_Reader;
+		};
+
+		//
+		// A block of typed properties
+		//  stored as one immutable flat block sorted by key hash, with interned keys, and no storage at all when empty
+		//  reads take no locks, writes are serialized and publish a new block
+		//  replaced blocks are freed by a later write, once every thread reading has left the scope it was in when they were replaced
+		//
+
+		class HELIUM_REFLECT_API PropertyCollection
+		{
 		public:
+			inline PropertyCollection();
+			PropertyCollection( const PropertyCollection& rhs );
+			~PropertyCollection();
+			PropertyCollection& operator=( const PropertyCollection& rhs );
+
 			template<class T>
-			inline void SetProperty( const std::string& key, const T& value ) const;
+			inline void SetProperty( const PropertyKey& key, const T& value ) const;
 
 			template<class T>
-			inline bool GetProperty( const std::string& key, T& value ) const;
+			inline bool GetProperty( const PropertyKey& key, T& value ) const;
+
+			inline std::string GetProperty( const PropertyKey& key ) const;
+
+			// the stored value for a key, NULL if it's not set (call inside a PropertyReadScope)
+			const PropertyValue* FindPropertyValue( const PropertyKey& key ) const;
+
+			// add the storage used by this collection to a footprint report
+			void AccumulateFootprint( PropertyFootprint& footprint ) const;
+
+		protected:
+			struct Property
+			{
+				uint32_t      m_KeyHash; // hash of the key, the sort order of the block
+				Name          m_Key;     // interned key
+				PropertyValue m_Value;
+			};
+
+			struct PropertyBlock
+			{
+				uint32_t       m_Count;
+				int32_t        m_RetiredEpoch; // the write epoch this block was replaced in
+				PropertyBlock* m_NextRetired;  // the next block waiting to be freed, once this one is replaced
+
+				inline Property* GetProperties();
+			};
+
+			// the published block, loaded with acquire semantics so its contents are visible
+			PropertyBlock* LoadProperties() const;
+
+			// index of the first property in the block whose key hash isn't less than hash
+			static uint32_t LowerBound( PropertyBlock* block, uint32_t hash );
+
+			// find the property for a key in a block, NULL if it's not set
+			static const Property* FindProperty( PropertyBlock* block, const PropertyKey& key );
+
+			// add or replace the value of a key
+			void SetPropertyValue( const PropertyKey& key, const PropertyValue& value ) const;
+
+			// release the current block
+			void ClearProperties();
+
+			// queue a block to be freed once no thread reading can still see it, and free those that none can (call with the write lock held)
+			static void RetireBlock( PropertyBlock* block );
+			static void FreeBlock( PropertyBlock* block );
+
+			mutable PropertyBlock* volatile m_Properties;
 
-			inline std::string GetProperty( const std::string& key ) const;
+			static PropertyBlock* s_RetiredBlocks; // replaced blocks waiting for the readers that may still see them
 		};
 
 		//
@@ -1,68 +1,148 @@
-template<class T>
-void Helium::Reflect::PropertyCollection::SetProperty( const std::string& key, const T& value ) const
+Helium::Reflect::PropertyCollection::PropertyCollection()
+	: m_Properties( NULL )
 {
-	std::ostringstream str;
-	str << value;
+}
 
-	if ( !str.fail() )
-	{
-		SetProperty<std::string>( key, str.str() );
-	}
+Helium::Reflect::PropertyCollection::Property* Helium::Reflect::PropertyCollection::PropertyBlock::GetProperties()
+{
+	return reinterpret_cast< Property* >( this + 1 );
 }
 
 namespace Helium
 {
 	namespace Reflect
 	{
-		template<>
-		inline void PropertyCollection::SetProperty( const std::string& key, const std::string& value ) const
+		// how a type converts to and from a property value: 0 integer, 1 floating point, 2 bool, 3 streamed through the string
+		template< class T, int Kind = std::is_same< T, bool >::value ? 2 : std::is_integral< T >::value ? 0 : std::is_floating_point< T >::value ? 1 : 3 >
+		struct _PropertyConverter;
+
+		template< class T >
+		struct _PropertyConverter< T, 0 >
 		{
-			m_Properties[key] = value;
-		}
-	}
-}
+			static void Set( const T& value, PropertyValue& property )
+			{
+				if ( std::is_unsigned< T >::value )
+				{
+					property.SetUnsigned( static_cast< uint64_t >( value ) );
+				}
+				else
+				{
+					property.SetInteger( static_cast< int64_t >( value ) );
+				}
+			}
 
-template<class T>
-bool Helium::Reflect::PropertyCollection::GetProperty( const std::string& key, T& value ) const
-{
-	std::string strValue;
-	bool result = GetProperty<std::string>( key, strValue );
+			static bool Get( const PropertyValue& property, T& value )
+			{
+				if ( property.m_Flags & PropertyFlags::Integer )
+				{
+					value = static_cast< T >( property.m_Integer );
+					return true;
+				}
+				if ( ( property.m_Flags & PropertyFlags::Unsigned ) && std::is_unsigned< T >::value && sizeof( T ) >= sizeof( uint64_t ) )
+				{
+					value = static_cast< T >( static_cast< uint64_t >( property.m_Integer ) );
+					return true;
+				}
+				return false;
+			}
+		};
 
-	if ( result )
-	{
-		std::istringstream str( strValue );
-		str >> value;
-		return !str.fail();
-	}
+		template< class T >
+		struct _PropertyConverter< T, 1 >
+		{
+			static void Set( const T& value, PropertyValue& property )
+			{
+				property.SetFloat( static_cast< float64_t >( value ) );
+			}
 
-	return false;
-}
+			static bool Get( const PropertyValue& property, T& value )
+			{
+				if ( property.m_Flags & PropertyFlags::Float )
+				{
+					value = static_cast< T >( property.m_Float );
+					return true;
+				}
+				return false;
+			}
+		};
+
+		template< class T >
+		struct _PropertyConverter< T, 2 >
+		{
+			static void Set( const T& value, PropertyValue& property )
+			{
+				property.SetBoolean( value );
+			}
+
+			static bool Get( const PropertyValue& property, T& value )
+			{
+				if ( property.m_Flags & PropertyFlags::Boolean )
+				{
+					value = property.m_Boolean;
+					return true;
+				}
+				return false;
+			}
+		};
+
+		template< class T >
+		struct _PropertyConverter< T, 3 >
+		{
+			static void Set( const T& value, PropertyValue& property )
+			{
+				std::ostringstream str;
+				str << value;
+				property.SetString( str.str() );
+			}
+
+			static bool Get( const PropertyValue& property, T& value )
+			{
+				std::istringstream str( property.m_String );
+				str >> value;
+				return !str.fail();
+			}
+		};
 
-namespace Helium
-{
-	namespace Reflect
-	{
 		template<>
-		inline bool PropertyCollection::GetProperty( const std::string& key, std::string& value ) const
+		struct _PropertyConverter< std::string, 3 >
 		{
-			std::map< std::string, std::string >::const_iterator found = m_Properties.find( key ); 
-			if ( found != m_Properties.end() )
+			static void Set( const std::string& value, PropertyValue& property )
 			{
-				value = found->second;
-				return true;
+				property.SetString( value );
 			}
 
-			return false;
-		}
+			static bool Get( const PropertyValue& property, std::string& value )
+			{
+				value = property.m_String;
+				return true;
+			}
+		};
 	}
 }
 
-inline std::string Helium::Reflect::PropertyCollection::GetProperty( const std::string& key ) const
+template<class T>
+void Helium::Reflect::PropertyCollection::SetProperty( const PropertyKey& key, const T& value ) const
+{
+	PropertyValue property;
+	_PropertyConverter< T >::Set( value, property );
+	SetPropertyValue( key, property );
+}
+
+template<class T>
+bool Helium::Reflect::PropertyCollection::GetProperty( const PropertyKey& key, T& value ) const
+{
+	PropertyReadScope scope;
+	const PropertyValue* property = FindPropertyValue( key );
+	return property && _PropertyConverter< T >::Get( *property, value );
+}
+
+std::string Helium::Reflect::PropertyCollection::GetProperty( const PropertyKey& key ) const
 {
-	std::map< std::string, std::string >::const_iterator found = m_Properties.find( key );
-	if ( found != m_Properties.end() )
+	PropertyReadScope scope;
+	const PropertyValue* property = FindPropertyValue( key );
+	if ( property )
 	{
-		return found->second;
+		return property->m_String;
 	}
 
 	return std::string ();
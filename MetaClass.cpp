@@ -8,6 +8,7 @@ using namespace Helium::Reflect;
 
 MetaClass::MetaClass()
 : m_Creator (NULL)
+, m_Copier (NULL)
 {
 
 }
@@ -30,7 +31,7 @@ MetaClass* MetaClass::Create()
 }
 
 template<>
-void MetaClass::Create< Object >( MetaClass const*& pointer, const char* name, const char* baseName, CreateObjectFunc creator )
+void MetaClass::Create< Object >( MetaClass const*& pointer, const char* name, const char* baseName, CreateObjectFunc creator, CopyObjectFunc copier )
 {
     MetaClass* type = MetaClass::Create();
     pointer = type;
@@ -39,7 +40,7 @@ void MetaClass::Create< Object >( MetaClass const*& pointer, const char* name, c
     type->m_Name = name;
 
     // object should have no creator
-    HELIUM_ASSERT( creator == NULL );
+    HELIUM_ASSERT( creator == NULL && copier == NULL );
 
     // object should have no base class
     HELIUM_ASSERT( baseName == NULL );
@@ -4,6 +4,9 @@
 
 #include "Reflect/MetaStruct.h"
 #include "Reflect/MetaEnum.h"
+#include "Reflect/ObjectArena.h"
+#include "Reflect/ObjectSampling.h"
+#include "Reflect/ObjectSlab.h"
 #include "Reflect/Registry.h"
 
 namespace Helium
@@ -13,6 +16,9 @@ namespace Helium
 		// function type for creating object instances
 		typedef Object* (*CreateObjectFunc)();
 
+		// function type for copy constructing object instances
+		typedef Object* (*CopyObjectFunc)( const Object* source );
+
 		//
 		// MetaClass (C++ `class`)
 		//
@@ -31,16 +37,17 @@ namespace Helium
 			static MetaClass* Create();
 
 			template< class ClassT >
-			static void Create( MetaClass const*& pointer, const char* name, const char* baseName, CreateObjectFunc creator = NULL );
+			static void Create( MetaClass const*& pointer, const char* name, const char* baseName, CreateObjectFunc creator = NULL, CopyObjectFunc copier = NULL );
 
 		public:
 			CreateObjectFunc        m_Creator;  // factory function for creating instances of this class
+			CopyObjectFunc          m_Copier;   // factory function for copy constructing instances of this class (NULL if it's copied by reflection)
 			StrongPtr< Object >     m_Default;  // a default instance of an object of this class
 		};
 
 		// Object, the most base class needs explicit implementation
 		template<>
-		void MetaClass::Create< Object >( MetaClass const*& pointer, const char* name, const char* baseName, CreateObjectFunc creator );
+		void MetaClass::Create< Object >( MetaClass const*& pointer, const char* name, const char* baseName, CreateObjectFunc creator, CopyObjectFunc copier );
 
 		template< class ClassT, class BaseT >
 		class MetaClassRegistrar : public MetaTypeRegistrar
@@ -69,7 +76,30 @@ namespace Helium
 // declares creator for constructable types
 #define _REFLECT_DECLARE_CREATOR( OBJECT ) \
 public: \
-static Helium::Reflect::Object* CreateObject() { return new OBJECT; }
+static Helium::Reflect::Object* CreateObject() { return Helium::Reflect::ObjectSampler::Constructed( new OBJECT, s_MetaClass ); }
+
+// declares copier for types that clone with their copy constructor
+#define _REFLECT_DECLARE_COPIER( OBJECT ) \
+public: \
+static Helium::Reflect::Object* CopyObject( const Helium::Reflect::Object* source ) { return Helium::Reflect::ObjectSampler::Constructed( new OBJECT( *static_cast< const OBJECT* >( source ) ), s_MetaClass ); }
+
+// declares slab allocation for a class (derived classes of another size that aren't pooled themselves, and objects made in an arena, use Object's allocation)
+#define _REFLECT_DECLARE_SLAB( OBJECT ) \
+public: \
+static Helium::Reflect::ObjectSlab s_ObjectSlab; \
+void* operator new( size_t bytes ) { return bytes == sizeof( OBJECT ) && !Helium::Reflect::ObjectArena::GetCurrent() ? s_ObjectSlab.Allocate() : Helium::Reflect::Object::operator new( bytes ); } \
+void* operator new( size_t /*bytes*/, void* memory ) { return memory; } \
+void operator delete( void* ptr, size_t bytes ) { if ( bytes == sizeof( OBJECT ) && !Helium::Reflect::ObjectArena::Contains( ptr ) ) { s_ObjectSlab.Free( ptr ); } else { Helium::Reflect::Object::operator delete( ptr, bytes ); } } \
+void operator delete( void* /*ptr*/, void* /*memory*/ ) {}
+
+// declares an inline reference count proxy for a class, allocated in front of each object instead of from the proxy pool
+//  (derived classes inherit it, and objects made in an arena come from the heap)
+#define _REFLECT_DECLARE_INLINE_REF_COUNT( OBJECT ) \
+public: \
+void* operator new( size_t bytes ) { return Helium::Reflect::ObjectRefCountSupport::AllocateInline( bytes ); } \
+void* operator new( size_t /*bytes*/, void* memory ) { return memory; } \
+void operator delete( void* ptr, size_t /*bytes*/ ) { Helium::Reflect::ObjectRefCountSupport::FreeInline( ptr ); } \
+void operator delete( void* /*ptr*/, void* /*memory*/ ) {}
 
 // declares type checking functions
 #define _REFLECT_DECLARE_CLASS( OBJECT, BASE ) \
@@ -84,7 +114,7 @@ static const Helium::Reflect::MetaClass* s_MetaClass;
 static Helium::Reflect::MetaClassRegistrar< OBJECT, BASE > s_Registrar;
 
 // defines the static type info vars
-#define _REFLECT_DEFINE_CLASS( OBJECT, CREATOR ) \
+#define _REFLECT_DEFINE_CLASS( OBJECT, CREATOR, COPIER ) \
 const Helium::Reflect::MetaClass* OBJECT::GetMetaClass() const \
 { \
 	return s_MetaClass; \
@@ -94,7 +124,7 @@ const Helium::Reflect::MetaClass* OBJECT::CreateMetaClass() \
 { \
 	HELIUM_ASSERT( s_MetaClass == NULL ); \
 	HELIUM_ASSERT( OBJECT::Base::s_MetaClass != NULL ); \
-	Helium::Reflect::MetaClass::Create< OBJECT >( s_MetaClass, TXT( #OBJECT ), OBJECT::Base::s_MetaClass->m_Name, CREATOR); \
+	Helium::Reflect::MetaClass::Create< OBJECT >( s_MetaClass, TXT( #OBJECT ), OBJECT::Base::s_MetaClass->m_Name, CREATOR, COPIER ); \
 	return s_MetaClass; \
 } \
 const Helium::Reflect::MetaClass* OBJECT::s_MetaClass = NULL;
@@ -102,6 +132,10 @@ const Helium::Reflect::MetaClass* OBJECT::s_MetaClass = NULL;
 #define _REFLECT_DEFINE_CLASS_REGISTRAR( OBJECT, CREATOR ) \
 Helium::Reflect::MetaClassRegistrar< OBJECT, OBJECT::Base > OBJECT::s_Registrar( TXT( #OBJECT ) );
 
+// defines the slab of a class, constant initialized so objects can be allocated at any time
+#define _REFLECT_DEFINE_SLAB( OBJECT ) \
+Helium::Reflect::ObjectSlab OBJECT::s_ObjectSlab = { TXT( #OBJECT ), sizeof( OBJECT ), Helium::Reflect::AlignmentOf< OBJECT >::Value, 0, 0, 0, NULL };
+
 // declares an abstract object (an object that either A: cannot be instantiated or B: is never actually serialized)
 #define HELIUM_DECLARE_ABSTRACT_NO_REGISTRAR( OBJECT, BASE ) \
 	_REFLECT_DECLARE_CLASS( OBJECT, BASE )
@@ -112,7 +146,7 @@ Helium::Reflect::MetaClassRegistrar< OBJECT, OBJECT::Base > OBJECT::s_Registrar(
 
 // defines the abstract object class
 #define HELIUM_DEFINE_ABSTRACT_NO_REGISTRAR( OBJECT ) \
-	_REFLECT_DEFINE_CLASS( OBJECT, NULL )
+	_REFLECT_DEFINE_CLASS( OBJECT, NULL, NULL )
 
 // defines the abstract object class
 #define HELIUM_DEFINE_ABSTRACT( OBJECT ) \
@@ -131,11 +165,62 @@ Helium::Reflect::MetaClassRegistrar< OBJECT, OBJECT::Base > OBJECT::s_Registrar(
 
 // defines a concrete object
 #define HELIUM_DEFINE_CLASS_NO_REGISTRAR( OBJECT ) \
-	_REFLECT_DEFINE_CLASS( OBJECT, &OBJECT::CreateObject )
+	_REFLECT_DEFINE_CLASS( OBJECT, &OBJECT::CreateObject, NULL )
 
 // defines a concrete object
 #define HELIUM_DEFINE_CLASS( OBJECT ) \
 	HELIUM_DEFINE_CLASS_NO_REGISTRAR( OBJECT ) \
 	_REFLECT_DEFINE_CLASS_REGISTRAR( OBJECT, &OBJECT::CreateObject )
 
+// declares a concrete object allocated from a slab of its size class
+#define HELIUM_DECLARE_POOLED_CLASS_NO_REGISTRAR( OBJECT, BASE ) \
+	HELIUM_DECLARE_CLASS_NO_REGISTRAR( OBJECT, BASE ) \
+	_REFLECT_DECLARE_SLAB( OBJECT )
+
+// declares a concrete object allocated from a slab of its size class
+#define HELIUM_DECLARE_POOLED_CLASS( OBJECT, BASE ) \
+	HELIUM_DECLARE_CLASS( OBJECT, BASE ) \
+	_REFLECT_DECLARE_SLAB( OBJECT )
+
+// defines a concrete object allocated from a slab of its size class
+#define HELIUM_DEFINE_POOLED_CLASS_NO_REGISTRAR( OBJECT ) \
+	HELIUM_DEFINE_CLASS_NO_REGISTRAR( OBJECT ) \
+	_REFLECT_DEFINE_SLAB( OBJECT )
+
+// defines a concrete object allocated from a slab of its size class
+#define HELIUM_DEFINE_POOLED_CLASS( OBJECT ) \
+	HELIUM_DEFINE_CLASS( OBJECT ) \
+	_REFLECT_DEFINE_SLAB( OBJECT )
+
+// declares a concrete object with its reference count proxy inline (defined with HELIUM_DEFINE_CLASS_NO_REGISTRAR)
+#define HELIUM_DECLARE_INLINE_REF_COUNT_CLASS_NO_REGISTRAR( OBJECT, BASE ) \
+	HELIUM_DECLARE_CLASS_NO_REGISTRAR( OBJECT, BASE ) \
+	_REFLECT_DECLARE_INLINE_REF_COUNT( OBJECT )
+
+// declares a concrete object with its reference count proxy inline (defined with HELIUM_DEFINE_CLASS)
+#define HELIUM_DECLARE_INLINE_REF_COUNT_CLASS( OBJECT, BASE ) \
+	HELIUM_DECLARE_CLASS( OBJECT, BASE ) \
+	_REFLECT_DECLARE_INLINE_REF_COUNT( OBJECT )
+
+// declares a concrete object cloned by its copy constructor, which must copy like reflection would
+//  (deep copying the objects it references, unless the field is shared), derived classes don't inherit the copier
+#define HELIUM_DECLARE_COPYABLE_CLASS_NO_REGISTRAR( OBJECT, BASE ) \
+	HELIUM_DECLARE_CLASS_NO_REGISTRAR( OBJECT, BASE ) \
+	_REFLECT_DECLARE_COPIER( OBJECT )
+
+// declares a concrete object cloned by its copy constructor, which must copy like reflection would
+//  (deep copying the objects it references, unless the field is shared), derived classes don't inherit the copier
+#define HELIUM_DECLARE_COPYABLE_CLASS( OBJECT, BASE ) \
+	HELIUM_DECLARE_CLASS( OBJECT, BASE ) \
+	_REFLECT_DECLARE_COPIER( OBJECT )
+
+// defines a concrete object cloned by its copy constructor
+#define HELIUM_DEFINE_COPYABLE_CLASS_NO_REGISTRAR( OBJECT ) \
+	_REFLECT_DEFINE_CLASS( OBJECT, &OBJECT::CreateObject, &OBJECT::CopyObject )
+
+// defines a concrete object cloned by its copy constructor
+#define HELIUM_DEFINE_COPYABLE_CLASS( OBJECT ) \
+	HELIUM_DEFINE_COPYABLE_CLASS_NO_REGISTRAR( OBJECT ) \
+	_REFLECT_DEFINE_CLASS_REGISTRAR( OBJECT, &OBJECT::CreateObject )
+
 #include "Reflect/MetaClass.inl"
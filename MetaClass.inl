@@ -1,5 +1,5 @@
 template< class ClassT >
-void Helium::Reflect::MetaClass::Create( MetaClass const*& pointer, const char* name, const char* baseName, CreateObjectFunc creator )
+void Helium::Reflect::MetaClass::Create( MetaClass const*& pointer, const char* name, const char* baseName, CreateObjectFunc creator, CopyObjectFunc copier )
 {
 	MetaClass* type = MetaClass::Create();
 	pointer = type;
@@ -7,8 +7,9 @@ void Helium::Reflect::MetaClass::Create( MetaClass const*& pointer, const char*
 	// populate reflection information
 	MetaStruct::Create< ClassT >( name, baseName, reinterpret_cast< PopulateMetaTypeFunc >( &ClassT::PopulateMetaType ), type );
 
-	// setup factory function
+	// setup factory functions
 	type->m_Creator = creator;
+	type->m_Copier = copier;
 
 	// fetch a potential default instance from the composite
 	ClassT* instance = static_cast< ClassT* >( type->MetaStruct::m_Default );
@@ -1,14 +1,18 @@
 #include "ReflectPch.h"
 #include "MetaEnum.h"
 
+#include "Platform/Atomic.h"
+
+#include "Foundation/Crc32.h"
 #include "Foundation/Log.h"
 #include "Foundation/String.h"
 
+#include <algorithm>
+
 using namespace Helium;
 using namespace Helium::Reflect;
 
 // TODO: Ditch STL in favor of Foundation containers
-// TODO: Switch to uint64_t for wider bitfield support
 // TODO: Make AddElement return an MetaEnum::Element for easier meta-data addition
 
 MetaEnum::Element::Element()
@@ -17,7 +21,7 @@ MetaEnum::Element::Element()
 
 }
 
-MetaEnum::Element::Element( uint32_t value, const std::string& name, const std::string& helpText )
+MetaEnum::Element::Element( uint64_t value, const std::string& name, const std::string& helpText )
 	: m_Value( value )
 	, m_Name( name )
 	, m_HelpText( helpText )
@@ -25,10 +29,47 @@ MetaEnum::Element::Element( uint32_t value, const std::string& name, const std::
 
 }
 
+// a value range at most this many times the element count (plus some slack) gets a direct indexed table
+static const uint32_t DenseValueRangeFactor = 2;
+static const uint32_t DenseValueRangeSlack = 16;
+
+// open addressed tables are a power of two at least twice the element count
+static uint32_t GetHashTableCapacity( uint32_t count )
+{
+	uint32_t capacity = 8;
+	while ( capacity < count * 2 )
+	{
+		capacity *= 2;
+	}
+	return capacity;
+}
+
+static uint32_t HashEnumValue( uint64_t value )
+{
+	return static_cast< uint32_t >( value ^ ( value >> 32 ) ) * 2654435761u;
+}
+
+// append text to a bounded buffer, counting the full length even once the buffer is exhausted
+static void AppendBounded( char* buffer, size_t bufferSize, size_t& length, const char* text, size_t textLength )
+{
+	if ( length < bufferSize )
+	{
+		size_t copy = std::min( textLength, bufferSize - 1 - length );
+		MemoryCopy( buffer + length, text, copy );
+		buffer[ length + copy ] = '\0';
+	}
+
+	length += textLength;
+}
+
 MetaEnum::MetaEnum()
 	: m_IsBitfield( true )
+	, m_TablesCurrent( 0 )
+	, m_ValueTableBase( 0 )
+	, m_ValueTableDense( false )
+	, m_ZeroElement( 0 )
 {
-
+	MemoryZero( m_BitTable, sizeof( m_BitTable ) );
 }
 
 MetaEnum::~MetaEnum()
@@ -40,12 +81,13 @@ void MetaEnum::Register() const
 {
 	MetaType::Register();
 
-	uint32_t computedSize = 0;
+	UpdateLookupTables();
+
 	DynamicArray< MetaEnum::Element >::ConstIterator itr = m_Elements.Begin();
 	DynamicArray< MetaEnum::Element >::ConstIterator end = m_Elements.End();
 	for ( ; itr != end; ++itr )
 	{
-		Log::Debug( TXT( "  Value: %8d, Name: %s\n" ), itr->m_Value, itr->m_Name.c_str() );
+		Log::Debug( TXT( "  Value: %8llu, Name: %s\n" ), static_cast< unsigned long long >( itr->m_Value ), itr->m_Name.c_str() );
 	}
 }
 
@@ -54,12 +96,15 @@ void MetaEnum::Unregister() const
 	MetaType::Unregister();
 }
 
-void MetaEnum::AddElement( uint32_t value, const std::string& name, const std::string& helpText )
+void MetaEnum::AddElement( uint64_t value, const std::string& name, const std::string& helpText )
 {
 	MetaEnum::Element element ( value, name, helpText );
 
 	m_Elements.Add( element );
 
+	// tables built for the old element list would miss this one, the next lookup rebuilds them
+	AtomicExchangeRelease( m_TablesCurrent, 0 );
+
 	// our enumeration is treated as a bitfield if every value is a exactly a power-of-two
 	if ( m_IsBitfield && ( ( value & ( value - 1 ) ) != 0 ) )
 	{
@@ -67,114 +112,166 @@ void MetaEnum::AddElement( uint32_t value, const std::string& name, const std::s
 	}
 }
 
-bool MetaEnum::IsValid(uint32_t value) const
+bool MetaEnum::IsValid(uint64_t value) const
 {
-	DynamicArray< MetaEnum::Element >::ConstIterator itr = m_Elements.Begin();
-	DynamicArray< MetaEnum::Element >::ConstIterator end = m_Elements.End();
-	for ( ; itr != end; ++itr )
-	{
-		if ( itr->m_Value == value )
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return FindElementByValue( value ) != NULL;
 }
 
 bool MetaEnum::GetValue(const std::string& str, uint32_t& value) const
 {
-	if ( m_IsBitfield )
-	{
-		std::vector< std::string > strs;
+	uint64_t wide = 0;
+	bool result = GetValue( str, wide );
+	value = static_cast< uint32_t >( wide );
+	return result;
+}
 
-		const char *string = str.c_str();
+bool MetaEnum::GetValue(const std::string& str, uint64_t& value) const
+{
+	return Parse( str.c_str(), str.length(), value );
+}
 
-		while ( const char *stringFromPipe = FindCharacter( string, '|' ) )
-		{
-			std::string str(string, stringFromPipe - string);
-			strs.push_back(str);
-			string = stringFromPipe + 1;
-		}
-		
-		strs.push_back( string );
+bool MetaEnum::GetString(const uint64_t value, std::string& str) const
+{
+	char buffer[ 256 ];
+	size_t length = 0;
+	if ( !Format( value, buffer, sizeof( buffer ), length ) )
+	{
+		return false;
+	}
 
-		return GetBitfieldValue( strs, value );
+	if ( length < sizeof( buffer ) )
+	{
+		str += buffer;
 	}
 	else
 	{
-		return GetSingleValue( str, value );
+		size_t start = str.length();
+		str.resize( start + length + 1 );
+		Format( value, &str[ start ], length + 1, length );
+		str.resize( start + length );
 	}
+
+	return true;
 }
 
-bool MetaEnum::GetString(const uint32_t value, std::string& str) const
+bool MetaEnum::Format(uint64_t value, char* buffer, size_t bufferSize, size_t& length) const
 {
-	if ( m_IsBitfield )
+	length = 0;
+	if ( bufferSize )
 	{
-		bool first = true;
+		buffer[ 0 ] = '\0';
+	}
 
-		std::vector< std::string > strs;
-		if (!GetBitfieldStrings(value, strs))
+	if ( !m_IsBitfield )
+	{
+		const Element* element = FindElementByValue( value );
+		if ( element )
 		{
-			return false;
+			AppendBounded( buffer, bufferSize, length, element->m_Name.c_str(), element->m_Name.length() );
+			return true;
 		}
 
-		if ( strs.empty() )
+		return false;
+	}
+
+	bool first = true;
+
+	UpdateLookupTables();
+
+	// the zero element matches every value, then one element per set bit
+	if ( m_ZeroElement )
+	{
+		const Element& element = m_Elements[ m_ZeroElement - 1 ];
+		AppendBounded( buffer, bufferSize, length, element.m_Name.c_str(), element.m_Name.length() );
+		first = false;
+	}
+
+	for ( uint64_t bits = value; bits; bits &= bits - 1 )
+	{
+		uint32_t bit = 0;
+		while ( !( bits & ( static_cast< uint64_t >( 1 ) << bit ) ) )
 		{
-			return true;
+			++bit;
 		}
 
-		// search the map
-		std::vector< std::string >::const_iterator itr = strs.begin();
-		std::vector< std::string >::const_iterator end = strs.end();
-		for ( ; itr != end; ++itr )
+		if ( m_BitTable[ bit ] )
 		{
+			const Element& element = m_Elements[ m_BitTable[ bit ] - 1 ];
 			if ( !first )
 			{
-				str += TXT("|");
+				AppendBounded( buffer, bufferSize, length, "|", 1 );
 			}
-
 			first = false;
+			AppendBounded( buffer, bufferSize, length, element.m_Name.c_str(), element.m_Name.length() );
+		}
+	}
+
+	return value == 0 || !first;
+}
+
+bool MetaEnum::Parse(const char* string, size_t length, uint64_t& value) const
+{
+	value = 0;
 
-			str += *itr;
+	if ( !m_IsBitfield )
+	{
+		const Element* element = FindElementByName( string, length );
+		if ( element )
+		{
+			value = element->m_Value;
+			return true;
 		}
 
-		return !first;
+		return false;
 	}
-	else
+
+	const char* end = string + length;
+	for ( const char* token = string; ; )
 	{
-		DynamicArray< MetaEnum::Element >::ConstIterator itr = m_Elements.Begin();
-		DynamicArray< MetaEnum::Element >::ConstIterator end = m_Elements.End();
-		for ( ; itr != end; ++itr )
+		const char* pipe = token;
+		while ( pipe != end && *pipe != '|' )
 		{
-			if ( itr->m_Value == value )
-			{
-				str = itr->m_Name;
-				return true;
-			}
+			++pipe;
 		}
 
-		return false;
+		const Element* element = FindElementByName( token, pipe - token );
+		if ( element )
+		{
+			SetFlags( value, element->m_Value );
+		}
+
+		if ( pipe == end )
+		{
+			break;
+		}
+
+		token = pipe + 1;
 	}
+
+	return true;
 }
 
-bool MetaEnum::GetSingleValue(const std::string& str, uint32_t& value) const
+bool MetaEnum::GetSingleValue(const std::string& str, uint64_t& value) const
 {
-	DynamicArray< MetaEnum::Element >::ConstIterator itr = m_Elements.Begin();
-	DynamicArray< MetaEnum::Element >::ConstIterator end = m_Elements.End();
-	for ( ; itr != end; ++itr )
+	const Element* element = FindElementByName( str.c_str(), str.length() );
+	if ( element )
 	{
-		if ( itr->m_Name == str )
-		{
-			value = itr->m_Value;
-			return true;
-		}
+		value = element->m_Value;
+		return true;
 	}
 
 	return false;
 }
 
 bool MetaEnum::GetBitfieldValue(const std::vector< std::string >& strs, uint32_t& value) const
+{
+	uint64_t wide = 0;
+	bool result = GetBitfieldValue( strs, wide );
+	value = static_cast< uint32_t >( wide );
+	return result;
+}
+
+bool MetaEnum::GetBitfieldValue(const std::vector< std::string >& strs, uint64_t& value) const
 {
 	value = 0;
 
@@ -185,11 +282,11 @@ bool MetaEnum::GetBitfieldValue(const std::vector< std::string >& strs, uint32_t
 		std::vector< std::string >::const_iterator end = strs.end();
 		for ( ; itr != end; ++itr )
 		{
-			uint32_t flags;
+			uint64_t flags;
 			if (GetSingleValue(*itr, flags))
 			{
 				// set the bitfield value
-				SetFlags( value, static_cast<uint32_t>(flags) );
+				SetFlags( value, flags );
 			}
 		}
 	}
@@ -197,7 +294,7 @@ bool MetaEnum::GetBitfieldValue(const std::vector< std::string >& strs, uint32_t
 	return value == 0 || !strs.empty();
 }
 
-bool MetaEnum::GetBitfieldStrings(const uint32_t value, std::vector< std::string >& strs) const
+bool MetaEnum::GetBitfieldStrings(const uint64_t value, std::vector< std::string >& strs) const
 {
 	HELIUM_ASSERT( m_IsBitfield );
 	if ( m_IsBitfield )
@@ -216,3 +313,194 @@ bool MetaEnum::GetBitfieldStrings(const uint32_t value, std::vector< std::string
 
 	return value == 0 || !strs.empty();
 }
+
+void MetaEnum::UpdateLookupTables() const
+{
+	// lookups only read the tables once they see them marked current, after the build that wrote them
+	if ( AtomicLoadAcquire( m_TablesCurrent ) )
+	{
+		return;
+	}
+
+	MutexScopeLock lock ( m_TableLock );
+	if ( !m_TablesCurrent )
+	{
+		BuildLookupTables();
+		AtomicExchangeRelease( m_TablesCurrent, 1 );
+	}
+}
+
+void MetaEnum::BuildLookupTables() const
+{
+	uint32_t count = static_cast< uint32_t >( m_Elements.GetSize() );
+
+	m_ValueTable.Clear();
+	m_NameTable.Clear();
+	m_NameCrcs.Clear();
+	m_ValueTableBase = 0;
+	m_ValueTableDense = false;
+	m_ZeroElement = 0;
+	MemoryZero( m_BitTable, sizeof( m_BitTable ) );
+
+	if ( count == 0 )
+	{
+		return;
+	}
+
+	uint64_t minimum = m_Elements.GetFirst().m_Value;
+	uint64_t maximum = minimum;
+	for ( uint32_t i=1; i<count; ++i )
+	{
+		minimum = std::min( minimum, m_Elements[ i ].m_Value );
+		maximum = std::max( maximum, m_Elements[ i ].m_Value );
+	}
+
+	// earlier elements win, matching a front to back scan when values or names repeat
+	uint64_t range = maximum - minimum;
+	if ( range < static_cast< uint64_t >( count ) * DenseValueRangeFactor + DenseValueRangeSlack )
+	{
+		m_ValueTableDense = true;
+		m_ValueTableBase = minimum;
+		m_ValueTable.Resize( static_cast< size_t >( range + 1 ) );
+		MemoryZero( m_ValueTable.GetData(), m_ValueTable.GetSize() * sizeof( uint32_t ) );
+		for ( uint32_t i=0; i<count; ++i )
+		{
+			uint32_t& slot = m_ValueTable[ static_cast< size_t >( m_Elements[ i ].m_Value - minimum ) ];
+			if ( !slot )
+			{
+				slot = i + 1;
+			}
+		}
+	}
+	else
+	{
+		uint32_t capacity = GetHashTableCapacity( count );
+		m_ValueTable.Resize( capacity );
+		MemoryZero( m_ValueTable.GetData(), capacity * sizeof( uint32_t ) );
+		for ( uint32_t i=0; i<count; ++i )
+		{
+			uint64_t value = m_Elements[ i ].m_Value;
+			for ( uint32_t slot = HashEnumValue( value ) & ( capacity - 1 ); ; slot = ( slot + 1 ) & ( capacity - 1 ) )
+			{
+				if ( !m_ValueTable[ slot ] )
+				{
+					m_ValueTable[ slot ] = i + 1;
+					break;
+				}
+
+				if ( m_Elements[ m_ValueTable[ slot ] - 1 ].m_Value == value )
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	uint32_t capacity = GetHashTableCapacity( count );
+	m_NameTable.Resize( capacity );
+	MemoryZero( m_NameTable.GetData(), capacity * sizeof( uint32_t ) );
+	m_NameCrcs.Reserve( count );
+	for ( uint32_t i=0; i<count; ++i )
+	{
+		const std::string& name = m_Elements[ i ].m_Name;
+		uint32_t crc = Crc32( name.c_str(), name.length() );
+		m_NameCrcs.Add( crc );
+
+		for ( uint32_t slot = crc & ( capacity - 1 ); ; slot = ( slot + 1 ) & ( capacity - 1 ) )
+		{
+			if ( !m_NameTable[ slot ] )
+			{
+				m_NameTable[ slot ] = i + 1;
+				break;
+			}
+
+			uint32_t other = m_NameTable[ slot ] - 1;
+			if ( m_NameCrcs[ other ] == crc && m_Elements[ other ].m_Name == name )
+			{
+				break;
+			}
+		}
+	}
+
+	if ( m_IsBitfield )
+	{
+		for ( uint32_t i=0; i<count; ++i )
+		{
+			uint64_t value = m_Elements[ i ].m_Value;
+			if ( value == 0 )
+			{
+				if ( !m_ZeroElement )
+				{
+					m_ZeroElement = i + 1;
+				}
+				continue;
+			}
+
+			uint32_t bit = 0;
+			while ( value != ( static_cast< uint64_t >( 1 ) << bit ) )
+			{
+				++bit;
+			}
+
+			if ( !m_BitTable[ bit ] )
+			{
+				m_BitTable[ bit ] = i + 1;
+			}
+		}
+	}
+}
+
+const MetaEnum::Element* MetaEnum::FindElementByValue( uint64_t value ) const
+{
+	UpdateLookupTables();
+	if ( m_ValueTable.IsEmpty() )
+	{
+		return NULL;
+	}
+
+	if ( m_ValueTableDense )
+	{
+		if ( value < m_ValueTableBase || value - m_ValueTableBase >= m_ValueTable.GetSize() )
+		{
+			return NULL;
+		}
+
+		uint32_t index = m_ValueTable[ static_cast< size_t >( value - m_ValueTableBase ) ];
+		return index ? &m_Elements[ index - 1 ] : NULL;
+	}
+
+	uint32_t mask = static_cast< uint32_t >( m_ValueTable.GetSize() ) - 1;
+	for ( uint32_t slot = HashEnumValue( value ) & mask; m_ValueTable[ slot ]; slot = ( slot + 1 ) & mask )
+	{
+		const Element& element = m_Elements[ m_ValueTable[ slot ] - 1 ];
+		if ( element.m_Value == value )
+		{
+			return &element;
+		}
+	}
+
+	return NULL;
+}
+
+const MetaEnum::Element* MetaEnum::FindElementByName( const char* name, size_t length ) const
+{
+	UpdateLookupTables();
+	if ( m_NameTable.IsEmpty() )
+	{
+		return NULL;
+	}
+
+	uint32_t crc = Crc32( name, length );
+	uint32_t mask = static_cast< uint32_t >( m_NameTable.GetSize() ) - 1;
+	for ( uint32_t slot = crc & mask; m_NameTable[ slot ]; slot = ( slot + 1 ) & mask )
+	{
+		uint32_t index = m_NameTable[ slot ] - 1;
+		const Element& element = m_Elements[ index ];
+		if ( m_NameCrcs[ index ] == crc && element.m_Name.length() == length && MemoryCompare( element.m_Name.c_str(), name, length ) == 0 )
+		{
+			return &element;
+		}
+	}
+
+	return NULL;
+}
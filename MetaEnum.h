@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Platform/Locks.h"
+
 #include "Foundation/DynamicArray.h"
 
 #include "Reflect/MetaType.h"
@@ -27,9 +29,9 @@ namespace Helium
 			{
 			public:
 				Element();
-				Element( uint32_t value, const std::string& name, const std::string& helpText = TXT( "FIXME: SET THE HELP TEXT FOR THIS ENUMERATION ELEMENT" ) );
+				Element( uint64_t value, const std::string& name, const std::string& helpText = TXT( "FIXME: SET THE HELP TEXT FOR THIS ENUMERATION ELEMENT" ) );
 
-				uint32_t        m_Value;    // the value of the object
+				uint64_t        m_Value;    // the value of the object
 				std::string     m_Name;     // the name of the object
 				std::string     m_HelpText; // the help text for the object
 			};
@@ -43,23 +45,52 @@ namespace Helium
 			virtual void Register() const HELIUM_OVERRIDE;
 			virtual void Unregister() const HELIUM_OVERRIDE;
 
-			void AddElement(uint32_t value, const std::string& name, const std::string& helpText = TXT( "FIXME: SET THE HELP TEXT FOR THIS ENUMERATION ELEMENT" ) );
-			bool IsValid(uint32_t value) const;
+			void AddElement(uint64_t value, const std::string& name, const std::string& helpText = TXT( "FIXME: SET THE HELP TEXT FOR THIS ENUMERATION ELEMENT" ) );
+			bool IsValid(uint64_t value) const;
 
 			bool GetValue(const std::string& str, uint32_t& value) const;
-			bool GetString(const uint32_t value, std::string& str) const;
+			bool GetValue(const std::string& str, uint64_t& value) const;
+			bool GetString(const uint64_t value, std::string& str) const;
+
+			// write the name of a value (bitfields: names joined by '|') into a buffer without allocating
+			//  length receives the full length, the output is truncated (but terminated) if it doesn't fit in bufferSize
+			bool Format(uint64_t value, char* buffer, size_t bufferSize, size_t& length) const;
+
+			// read a value from a name (bitfields: names joined by '|') in place, string needn't be terminated
+			bool Parse(const char* string, size_t length, uint64_t& value) const;
 
 			bool GetBitfieldValue(const std::vector< std::string >& strs, uint32_t& value) const;
-			bool GetBitfieldStrings(const uint32_t value, std::vector< std::string >& strs) const;
+			bool GetBitfieldValue(const std::vector< std::string >& strs, uint64_t& value) const;
+			bool GetBitfieldStrings(const uint64_t value, std::vector< std::string >& strs) const;
 
-			inline static bool IsFlagSet(uint32_t value, uint32_t flag);
+			inline static bool IsFlagSet(uint64_t value, uint64_t flag);
 			inline static void SetFlags(uint32_t& value, uint32_t flags);
+			inline static void SetFlags(uint64_t& value, uint64_t flags);
 
 			DynamicArray< MetaEnum::Element > m_Elements;
 			bool                              m_IsBitfield;
 
 		private:
-			bool GetSingleValue(const std::string& str, uint32_t& value) const;
+			bool GetSingleValue(const std::string& str, uint64_t& value) const;
+
+			// build the lookup tables if they are stale (elements were added since they were built), at registration or on first use
+			void UpdateLookupTables() const;
+			void BuildLookupTables() const;
+
+			// the element with a value or name, NULL if there isn't one
+			const Element* FindElementByValue( uint64_t value ) const;
+			const Element* FindElementByName( const char* name, size_t length ) const;
+
+			// lookup tables hold element index + 1, zero marks an empty slot
+			mutable Mutex                    m_TableLock;      // serializes rebuilding stale tables
+			mutable volatile int32_t         m_TablesCurrent;  // the tables cover every element
+			mutable DynamicArray< uint32_t > m_ValueTable;     // direct indexed by value - m_ValueTableBase when values are dense, else open addressed by value hash
+			mutable uint64_t                 m_ValueTableBase;
+			mutable bool                     m_ValueTableDense;
+			mutable DynamicArray< uint32_t > m_NameTable;      // open addressed by name CRC
+			mutable DynamicArray< uint32_t > m_NameCrcs;       // name CRC of each element
+			mutable uint32_t                 m_BitTable[ 64 ]; // bitfields: the element for each bit
+			mutable uint32_t                 m_ZeroElement;    // bitfields: the element for zero
 		};
 
 		template< class EnumT >
@@ -10,7 +10,7 @@ void Helium::Reflect::MetaEnum::Create( MetaEnum const*& pointer, const char* na
 	T::PopulateMetaType( *type );
 }
 
-bool Helium::Reflect::MetaEnum::IsFlagSet(uint32_t value, uint32_t flag)
+bool Helium::Reflect::MetaEnum::IsFlagSet(uint64_t value, uint64_t flag)
 {
 	return ((value & flag) == flag);
 }
@@ -20,6 +20,11 @@ void Helium::Reflect::MetaEnum::SetFlags(uint32_t& value, uint32_t flags)
 	value |= flags;
 }
 
+void Helium::Reflect::MetaEnum::SetFlags(uint64_t& value, uint64_t flags)
+{
+	value |= flags;
+}
+
 template< class EnumerationT >
 Helium::Reflect::MetaEnumRegistrar< EnumerationT >::MetaEnumRegistrar(const char* name)
 	: MetaTypeRegistrar( name )
@@ -8,6 +8,7 @@
 #include "Reflect/Registry.h"
 #include "Reflect/MetaEnum.h"
 #include "Reflect/TranslatorDeduction.h"
+#include "Reflect/ScalarKernels.h"
 
 using namespace Helium;
 using namespace Helium::Reflect;
@@ -32,10 +33,71 @@ Field::Field()
 Method::Method()
 : m_Structure( NULL )
 , m_Name( NULL )
+, m_NameCrc( 0 )
 {
 
 }
 
+void Method::Invoke( void* instance, ArgumentFrame& frame ) const
+{
+	HELIUM_ASSERT( frame.m_Method == this );
+	MethodCall call ( instance, frame.m_Address );
+	m_Delegate->Invoke( &call );
+}
+
+void Method::Invoke( void* instance ) const
+{
+	ArgumentFrame frame ( *this );
+	Invoke( instance, frame );
+}
+
+void Method::Invoke( void* const* instances, size_t count, ArgumentFrame& frame ) const
+{
+	HELIUM_ASSERT( frame.m_Method == this );
+	MethodCall call ( NULL, frame.m_Address );
+	for ( size_t i=0; i<count; ++i )
+	{
+		call.m_Instance = instances[ i ];
+		m_Delegate->Invoke( &call );
+	}
+}
+
+void ArgumentFrame::Reset()
+{
+	m_Translator->Destruct( *this );
+	m_Translator->Construct( *this );
+}
+
+StaticOperations::StaticOperations()
+: m_Copy( NULL )
+, m_Equals( NULL )
+, m_Hash( NULL )
+, m_Write( NULL )
+, m_Read( NULL )
+{
+
+}
+
+Visitor::~Visitor()
+{
+
+}
+
+bool Visitor::VisitField( const Field* field, Pointer pointer )
+{
+	return true;
+}
+
+bool Visitor::VisitItem( Pointer item, Translator* translator )
+{
+	return true;
+}
+
+bool Visitor::VisitPair( Pointer key, ScalarTranslator* keyTranslator, Pointer value, Translator* valueTranslator )
+{
+	return true;
+}
+
 bool Field::IsDefaultValue( void* address, Object* object, uint32_t index ) const
 {
 	Pointer value ( this, address, object, index );
@@ -167,12 +229,33 @@ bool MetaStruct::Equals(void* compositeA, Object* objectA, void* compositeB, Obj
 
 	for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
 	{
+		if ( current->m_Static.m_Equals )
+		{
+			if ( !current->m_Static.m_Equals( current, compositeA, compositeB ) )
+			{
+				return false;
+			}
+			continue;
+		}
+
 		DynamicArray< Field >::ConstIterator itr = current->m_Fields.Begin();
 		DynamicArray< Field >::ConstIterator end = current->m_Fields.End();
 		for ( ; itr != end; ++itr )
 		{
 			const Field* field = &*itr;
 
+			// native scalars compare every element in one statically typed call
+			if ( const ScalarKernel* kernel = GetScalarKernel( field->m_Translator.Ptr() ) )
+			{
+				Pointer a ( field, compositeA, objectA );
+				Pointer b ( field, compositeB, objectB );
+				if ( !kernel->m_Equals( a.m_Address, b.m_Address, field->m_Count ) )
+				{
+					return false;
+				}
+				continue;
+			}
+
 			for ( uint32_t i=0; i<field->m_Count; ++i )
 			{
 				Pointer a ( field, compositeA, objectA, i );
@@ -195,12 +278,28 @@ void MetaStruct::Copy( void* compositeSource, Object* objectSource, void* compos
 	{
 		for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
 		{
+			// value-only field lists have no shallow/deep distinction
+			if ( current->m_Static.m_Copy )
+			{
+				current->m_Static.m_Copy( compositeSource, compositeDestination );
+				continue;
+			}
+
 			DynamicArray< Field >::ConstIterator itr = current->m_Fields.Begin();
 			DynamicArray< Field >::ConstIterator end = current->m_Fields.End();
 			for ( ; itr != end; ++itr )
 			{
 				const Field* field = &*itr;
 
+				// native scalars copy every element in one statically typed call
+				if ( const ScalarKernel* kernel = GetScalarKernel( field->m_Translator.Ptr() ) )
+				{
+					Pointer pointerSource ( field, compositeSource, objectSource );
+					Pointer pointerDestination ( field, compositeDestination, objectDestination );
+					kernel->m_Copy( pointerSource.m_Address, pointerDestination.m_Address, field->m_Count );
+					continue;
+				}
+
 				for ( uint32_t i=0; i<field->m_Count; ++i )
 				{
 					Pointer pointerSource ( field, compositeSource, objectSource, i );
@@ -216,6 +315,206 @@ void MetaStruct::Copy( void* compositeSource, Object* objectSource, void* compos
 	}
 }
 
+void MetaStruct::Move( void* compositeSource, Object* objectSource, void* compositeDestination, Object* objectDestination ) const
+{
+	if ( compositeSource != compositeDestination )
+	{
+		for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
+		{
+			DynamicArray< Field >::ConstIterator itr = current->m_Fields.Begin();
+			DynamicArray< Field >::ConstIterator end = current->m_Fields.End();
+			for ( ; itr != end; ++itr )
+			{
+				const Field* field = &*itr;
+
+				for ( uint32_t i=0; i<field->m_Count; ++i )
+				{
+					Pointer pointerSource ( field, compositeSource, objectSource, i );
+					Pointer pointerDestination ( field, compositeDestination, objectDestination, i );
+					field->m_Translator->Move( pointerSource, pointerDestination );
+				}
+			}
+		}
+	}
+}
+
+void MetaStruct::Swap( void* compositeA, Object* objectA, void* compositeB, Object* objectB ) const
+{
+	if ( compositeA != compositeB )
+	{
+		for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
+		{
+			DynamicArray< Field >::ConstIterator itr = current->m_Fields.Begin();
+			DynamicArray< Field >::ConstIterator end = current->m_Fields.End();
+			for ( ; itr != end; ++itr )
+			{
+				const Field* field = &*itr;
+
+				for ( uint32_t i=0; i<field->m_Count; ++i )
+				{
+					Pointer a ( field, compositeA, objectA, i );
+					Pointer b ( field, compositeB, objectB, i );
+					field->m_Translator->Swap( a, b );
+				}
+			}
+		}
+	}
+}
+
+bool MetaStruct::Hash( const void* composite, uint32_t& hash ) const
+{
+	uint32_t result = 2166136261u;
+	for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
+	{
+		if ( current->m_Static.m_Hash )
+		{
+			result = current->m_Static.m_Hash( composite, result );
+		}
+		else if ( !current->m_Fields.IsEmpty() )
+		{
+			return false;
+		}
+	}
+
+	hash = result;
+	return true;
+}
+
+bool MetaStruct::Write( const void* composite, Stream& stream ) const
+{
+	for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
+	{
+		if ( !current->m_Static.m_Write && !current->m_Fields.IsEmpty() )
+		{
+			return false;
+		}
+	}
+
+	for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
+	{
+		if ( current->m_Static.m_Write )
+		{
+			current->m_Static.m_Write( composite, stream );
+		}
+	}
+
+	return true;
+}
+
+bool MetaStruct::Read( void* composite, Stream& stream ) const
+{
+	for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
+	{
+		if ( !current->m_Static.m_Read && !current->m_Fields.IsEmpty() )
+		{
+			return false;
+		}
+	}
+
+	for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
+	{
+		if ( current->m_Static.m_Read )
+		{
+			current->m_Static.m_Read( composite, stream );
+		}
+	}
+
+	return true;
+}
+
+void MetaStruct::Visit( void* composite, Object* object, Visitor& visitor ) const
+{
+	if ( !composite )
+	{
+		return;
+	}
+
+	for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
+	{
+		DynamicArray< Field >::ConstIterator itr = current->m_Fields.Begin();
+		DynamicArray< Field >::ConstIterator end = current->m_Fields.End();
+		for ( ; itr != end; ++itr )
+		{
+			const Field* field = &*itr;
+
+			for ( uint32_t i=0; i<field->m_Count; ++i )
+			{
+				Pointer pointer ( field, composite, object, i );
+				if ( visitor.VisitField( field, pointer ) )
+				{
+					Visit( pointer, field->m_Translator.Ptr(), visitor );
+				}
+			}
+		}
+	}
+}
+
+void MetaStruct::Visit( Pointer pointer, Translator* translator, Visitor& visitor )
+{
+	if ( StructureTranslator* structure = ReflectionCast< StructureTranslator >( translator ) )
+	{
+		structure->GetMetaStruct()->Visit( pointer.m_Address, pointer.m_Object, visitor );
+	}
+	else if ( SetTranslator* set = ReflectionCast< SetTranslator >( translator ) )
+	{
+		Translator* itemTranslator = set->GetItemTranslator();
+
+		ContainerCursor cursor;
+		for ( bool valid = set->Begin( pointer, cursor ); valid; valid = set->Next( cursor ) )
+		{
+			if ( visitor.VisitItem( cursor.m_Item, itemTranslator ) )
+			{
+				Visit( cursor.m_Item, itemTranslator, visitor );
+			}
+		}
+	}
+	else if ( SequenceTranslator* sequence = ReflectionCast< SequenceTranslator >( translator ) )
+	{
+		Translator* itemTranslator = sequence->GetItemTranslator();
+
+		ContainerCursor cursor;
+		for ( bool valid = sequence->Begin( pointer, cursor ); valid; valid = sequence->Next( cursor ) )
+		{
+			if ( visitor.VisitItem( cursor.m_Item, itemTranslator ) )
+			{
+				Visit( cursor.m_Item, itemTranslator, visitor );
+			}
+		}
+	}
+	else if ( AssociationTranslator* association = ReflectionCast< AssociationTranslator >( translator ) )
+	{
+		ScalarTranslator* keyTranslator = association->GetKeyTranslator();
+		Translator* valueTranslator = association->GetValueTranslator();
+
+		ContainerCursor cursor;
+		for ( bool valid = association->Begin( pointer, cursor ); valid; valid = association->Next( cursor ) )
+		{
+			if ( visitor.VisitPair( cursor.m_Item, keyTranslator, cursor.m_Value, valueTranslator ) )
+			{
+				Visit( cursor.m_Value, valueTranslator, visitor );
+			}
+		}
+	}
+}
+
+const Method* MetaStruct::FindMethodByName( uint32_t crc ) const
+{
+	for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
+	{
+		DynamicArray< Method >::ConstIterator itr = current->m_Methods.Begin();
+		DynamicArray< Method >::ConstIterator end = current->m_Methods.End();
+		for ( ; itr != end; ++itr )
+		{
+			if ( itr->m_NameCrc == crc )
+			{
+				return &*itr;
+			}
+		}
+	}
+
+	return NULL;
+}
+
 const Field* MetaStruct::FindFieldByName(uint32_t crc) const
 {
 	for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
@@ -238,7 +537,7 @@ const Field* MetaStruct::FindFieldByIndex(uint32_t index) const
 {
 	for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
 	{
-		if ( current->m_Fields.GetSize() && index >= current->m_Fields.GetFirst().m_Index && index <= current->m_Fields.GetFirst().m_Index )
+		if ( current->m_Fields.GetSize() && index >= current->m_Fields.GetFirst().m_Index && index <= current->m_Fields.GetLast().m_Index )
 		{
 			return &current->m_Fields[ index - current->m_Fields.GetFirst().m_Index ];
 		}
@@ -249,19 +548,16 @@ const Field* MetaStruct::FindFieldByIndex(uint32_t index) const
 
 const Field* MetaStruct::FindFieldByOffset(uint32_t offset) const
 {
-	// TODO: Implement binary search
+	// TODO: Implement binary search (fields aren't necessarily added in the order of their offsets)
 	for ( const MetaStruct* current = this; current != NULL; current = current->m_Base )
 	{
-		if ( current->m_Fields.GetSize() && offset >= current->m_Fields.GetFirst().m_Offset && offset <= current->m_Fields.GetFirst().m_Offset )
+		DynamicArray< Field >::ConstIterator itr = current->m_Fields.Begin();
+		DynamicArray< Field >::ConstIterator end = current->m_Fields.End();
+		for ( ; itr != end; ++itr )
 		{
-			DynamicArray< Field >::ConstIterator itr = current->m_Fields.Begin();
-			DynamicArray< Field >::ConstIterator end = current->m_Fields.End();
-			for ( ; itr != end; ++itr )
+			if ( itr->m_Offset == offset )
 			{
-				if ( itr->m_Offset == offset )
-				{
-					return &*itr;
-				}
+				return &*itr;
 			}
 		}
 	}
@@ -275,9 +571,9 @@ uint32_t MetaStruct::GetBaseFieldCount() const
 
 	for ( const MetaStruct* base = m_Base; base; base = base->m_Base )
 	{
-		if ( m_Base->m_Fields.GetSize() )
+		if ( base->m_Fields.GetSize() )
 		{
-			count = m_Base->m_Fields.GetLast().m_Index + 1;
+			count = base->m_Fields.GetLast().m_Index + 1;
 			break;
 		}
 	}
@@ -287,6 +583,9 @@ uint32_t MetaStruct::GetBaseFieldCount() const
 
 Reflect::Field* MetaStruct::AllocateField()
 {
+	// fields added outside a static field list aren't covered by its generated operations
+	m_Static = StaticOperations();
+
 	Field field;
 	field.m_Structure = this;
 	field.m_Index = GetBaseFieldCount() + (uint32_t)m_Fields.GetSize();
@@ -301,3 +600,70 @@ Reflect::Method* MetaStruct::AllocateMethod()
 	m_Methods.Add( method );
 	return &m_Methods.GetLast();
 }
+
+// can the data be copied by assignment and compared by operator== without changing meaning (deep copied object pointers can't)
+static bool HasValueSemantics( Translator* translator )
+{
+	if ( translator->IsA( MetaIds::PointerTranslator ) )
+	{
+		return false;
+	}
+
+	if ( StructureTranslator* structure = ReflectionCast< StructureTranslator >( translator ) )
+	{
+		for ( const MetaStruct* current = structure->GetMetaStruct(); current != NULL; current = current->m_Base )
+		{
+			DynamicArray< Field >::ConstIterator itr = current->m_Fields.Begin();
+			DynamicArray< Field >::ConstIterator end = current->m_Fields.End();
+			for ( ; itr != end; ++itr )
+			{
+				if ( !HasValueSemantics( itr->m_Translator.Ptr() ) )
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	if ( SetTranslator* set = ReflectionCast< SetTranslator >( translator ) )
+	{
+		return HasValueSemantics( set->GetItemTranslator() );
+	}
+
+	if ( SequenceTranslator* sequence = ReflectionCast< SequenceTranslator >( translator ) )
+	{
+		return HasValueSemantics( sequence->GetItemTranslator() );
+	}
+
+	if ( AssociationTranslator* association = ReflectionCast< AssociationTranslator >( translator ) )
+	{
+		return HasValueSemantics( association->GetKeyTranslator() ) && HasValueSemantics( association->GetValueTranslator() );
+	}
+
+	return true;
+}
+
+void MetaStruct::SetStaticOperations( const StaticOperations& operations )
+{
+	m_Static = operations;
+
+	DynamicArray< Field >::ConstIterator itr = m_Fields.Begin();
+	DynamicArray< Field >::ConstIterator end = m_Fields.End();
+	for ( ; itr != end; ++itr )
+	{
+		Translator* translator = itr->m_Translator.Ptr();
+		if ( !HasValueSemantics( translator ) || ( itr->m_Flags & FieldFlags::Share ) )
+		{
+			m_Static.m_Copy = NULL;
+			m_Static.m_Equals = NULL;
+		}
+
+		if ( !GetScalarKernel( translator ) )
+		{
+			m_Static.m_Hash = NULL;
+			m_Static.m_Write = NULL;
+			m_Static.m_Read = NULL;
+		}
+	}
+}
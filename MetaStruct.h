@@ -59,10 +59,42 @@ namespace Helium
 			SmartPtr< Translator > m_Translator; // interface to the data
 		};
 
+		//
+		// FieldBitSet (a set of the fields of a type, by their index)
+		//
+
+		class FieldBitSet
+		{
+		public:
+			inline void Set( uint32_t index );
+			inline void Reset( uint32_t index );
+			inline bool Test( uint32_t index ) const;
+
+			// merge the fields of another set into this one
+			inline void Add( const FieldBitSet& other );
+
+			inline bool IsEmpty() const;
+			inline void Clear();
+
+		private:
+			DynamicArray< uint32_t > m_Words;
+		};
+
 		//
 		// Method (member function of a composite)
 		//
 
+		class ArgumentFrame;
+
+		// the argument of m_Delegate, the instance to call and the constructed argument to pass
+		struct HELIUM_REFLECT_API MethodCall
+		{
+			inline MethodCall( void* instance, void* argument );
+
+			void* m_Instance;
+			void* m_Argument;
+		};
+
 		class HELIUM_REFLECT_API Method : public PropertyCollection
 		{
 		public:
@@ -70,10 +102,85 @@ namespace Helium
 
 			Method();
 
+			// call the method on an instance, passing the argument held by the frame
+			void Invoke( void* instance, ArgumentFrame& frame ) const;
+
+			// call the method on an instance with a default constructed argument
+			void Invoke( void* instance ) const;
+
+			// call the method on each instance in order, passing the same argument to every call
+			void Invoke( void* const* instances, size_t count, ArgumentFrame& frame ) const;
+
 			const MetaStruct*      m_Structure;    // the type we are a field of
 			const char*            m_Name;         // name of this field
+			uint32_t               m_NameCrc;      // CRC of the name
 			SmartPtr< Translator > m_Translator;   // the argument type
-			DelegateImplPtr        m_Delegate;     // the delegate to invoke the call
+			DelegateImplPtr        m_Delegate;     // the delegate to invoke the call, takes a MethodCall*
+		};
+
+		//
+		// ArgumentFrame (a constructed argument for a method, reusable across calls and instances)
+		//
+
+		class HELIUM_REFLECT_API ArgumentFrame : public Variable
+		{
+		public:
+			inline ArgumentFrame( const Method& method );
+
+			// restore the default constructed argument
+			void Reset();
+
+			const Method* m_Method;
+		};
+
+		//
+		// Visitor (callbacks for the data reachable from a composite, see MetaStruct::Visit)
+		//
+
+		class HELIUM_REFLECT_API Visitor
+		{
+		public:
+			virtual ~Visitor();
+
+			// called for each field instance (each element of a static array), return false to skip its contents
+			virtual bool VisitField( const Field* field, Pointer pointer );
+
+			// called for each item of a set or sequence, return false to skip its contents
+			virtual bool VisitItem( Pointer item, Translator* translator );
+
+			// called for each pair of an association, return false to skip the contents of the value
+			virtual bool VisitPair( Pointer key, ScalarTranslator* keyTranslator, Pointer value, Translator* valueTranslator );
+		};
+
+		//
+		// StaticOperations (fully inlined operations generated from a compile-time field list)
+		//  a structure may declare its fields once as a static template function:
+		//
+		//   template< class VisitorT > static void VisitStaticFields( VisitorT& visitor )
+		//   {
+		//       visitor( &Foo::m_Bar, "Bar" );
+		//       visitor( &Foo::m_Baz, "Baz", FieldFlags::Discard );
+		//   }
+		//
+		//  and call comp.AddStaticFields< Foo >() from PopulateMetaType, which adds the ordinary
+		//  Field table from the same list and installs the generated operations on the MetaStruct
+		//
+
+		struct HELIUM_REFLECT_API StaticOperations
+		{
+			typedef void     (*CopyFunc)( const void* source, void* destination );
+			typedef bool     (*EqualsFunc)( const MetaStruct* structure, const void* a, const void* b );
+			typedef uint32_t (*HashFunc)( const void* composite, uint32_t hash );
+			typedef void     (*WriteFunc)( const void* composite, Stream& stream );
+			typedef void     (*ReadFunc)( void* composite, Stream& stream );
+
+			StaticOperations();
+
+			CopyFunc   m_Copy;   // only when every field has value semantics (no object pointers)
+			EqualsFunc m_Equals; // only when every field has value semantics (no object pointers)
+			HashFunc   m_Hash;   // only when every field is a native scalar
+			WriteFunc  m_Write;  // only when every field is a native scalar, skips discarded fields like serialization does
+			ReadFunc   m_Read;   // only when every field is a native scalar, skips discarded fields like serialization does
 		};
 
 		//
@@ -127,6 +234,28 @@ namespace Helium
 			// copies data from one instance to another by finding a common base class and cloning all of the fields from the source object into the destination object.
 			void Copy( void* compositeSource, Object* objectSource, void* compositeDestination, Object* objectDestination, bool shallowCopy = false ) const;
 
+			// moves data from one instance to another field by field, leaving the source valid but unspecified
+			void Move( void* compositeSource, Object* objectSource, void* compositeDestination, Object* objectDestination ) const;
+
+			// exchanges data between two instances field by field
+			void Swap( void* compositeA, Object* objectA, void* compositeB, Object* objectB ) const;
+
+			// hashes a composite instance of *this* type, false if some type in the hierarchy has no static hash
+			bool Hash( const void* composite, uint32_t& hash ) const;
+
+			// binary write/read of a composite instance of *this* type, false if some type in the hierarchy has no static stream operations
+			bool Write( const void* composite, Stream& stream ) const;
+			bool Read( void* composite, Stream& stream ) const;
+
+			// walks the fields of a composite instance of *this* type, descending into structures and containers without allocating
+			void Visit( void* composite, Object* object, Visitor& visitor ) const;
+
+			// walks data described by a translator, descending into structures and containers
+			static void Visit( Pointer pointer, Translator* translator, Visitor& visitor );
+
+			// find a method in this composite (or its bases)
+			const Method* FindMethodByName( uint32_t crc ) const;
+
 			// find a field in this composite
 			const Field* FindFieldByName(uint32_t crc) const;
 			const Field* FindFieldByIndex(uint32_t index) const;
@@ -185,6 +314,13 @@ namespace Helium
 			template < class StructureT, class ArgumentT >
 			Reflect::Method* AddMethod( void (StructureT::*method)( ArgumentT& ), const char* name );
 
+			// append the fields of a compile-time field list (StructureT::VisitStaticFields) and install its generated operations
+			template < class StructureT >
+			void AddStaticFields();
+
+			// install generated operations, dropping any the field table doesn't support
+			void SetStaticOperations( const StaticOperations& operations );
+
 		public:
 			const MetaStruct*         m_Base;         // the base type name
 			mutable const MetaStruct* m_FirstDerived; // head of the derived linked list, mutable since its populated by other objects
@@ -194,6 +330,7 @@ namespace Helium
 			PopulateMetaTypeFunc      m_Populate;     // function to populate this structure
 			void*                     m_Default;      // default instance
 			DefaultDeleteFunc         m_DefaultDelete;// function to use to delete the default instance
+			StaticOperations          m_Static;       // inlined operations over this type's own fields, if it declares static fields
 		};
 
 		template< class ClassT, class BaseT >
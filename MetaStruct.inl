@@ -11,6 +11,63 @@ namespace Helium
 	}
 }
 
+void Helium::Reflect::FieldBitSet::Set( uint32_t index )
+{
+	size_t word = index / 32;
+	if ( word >= m_Words.GetSize() )
+	{
+		m_Words.Add( 0, word + 1 - m_Words.GetSize() );
+	}
+
+	m_Words[ word ] |= 1u << ( index % 32 );
+}
+
+void Helium::Reflect::FieldBitSet::Reset( uint32_t index )
+{
+	size_t word = index / 32;
+	if ( word < m_Words.GetSize() )
+	{
+		m_Words[ word ] &= ~( 1u << ( index % 32 ) );
+	}
+}
+
+bool Helium::Reflect::FieldBitSet::Test( uint32_t index ) const
+{
+	size_t word = index / 32;
+	return word < m_Words.GetSize() && ( m_Words[ word ] & ( 1u << ( index % 32 ) ) ) != 0;
+}
+
+void Helium::Reflect::FieldBitSet::Add( const FieldBitSet& other )
+{
+	if ( other.m_Words.GetSize() > m_Words.GetSize() )
+	{
+		m_Words.Add( 0, other.m_Words.GetSize() - m_Words.GetSize() );
+	}
+
+	for ( size_t i=0; i<other.m_Words.GetSize(); ++i )
+	{
+		m_Words[ i ] |= other.m_Words[ i ];
+	}
+}
+
+bool Helium::Reflect::FieldBitSet::IsEmpty() const
+{
+	for ( size_t i=0; i<m_Words.GetSize(); ++i )
+	{
+		if ( m_Words[ i ] )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void Helium::Reflect::FieldBitSet::Clear()
+{
+	m_Words.Clear();
+}
+
 template< class StructureT >
 void Helium::Reflect::MetaStruct::Create( MetaStruct const*& pointer, const char* name, const char* baseName )
 {
@@ -163,21 +220,53 @@ Helium::Reflect::Field* Helium::Reflect::MetaStruct::AddField( FieldT StructureT
 	return f;
 }
 
+Helium::Reflect::MethodCall::MethodCall( void* instance, void* argument )
+	: m_Instance( instance )
+	, m_Argument( argument )
+{
+}
+
+Helium::Reflect::ArgumentFrame::ArgumentFrame( const Method& method )
+	: Variable( method.m_Translator.Ptr() )
+	, m_Method( &method )
+{
+}
+
 namespace Helium
 {
 	namespace Reflect
 	{
-		template< class ArgumentT >
-		void _ConstructArgument( void* address )
+		// statically typed call of a member function, the instance and argument arrive through a MethodCall
+		template< class StructureT, class ArgumentT >
+		class _MethodDelegate : public Delegate< void* >::DelegateImpl
 		{
-			new ( static_cast<ArgumentT*>( address ) ) ArgumentT;
-		}
+		public:
+			typedef void (StructureT::*MethodType)( ArgumentT& );
 
-		template< class ArgumentT >
-		void _DestructArgument( void* address )
-		{
-			( static_cast<ArgumentT*>( address ) )->~ArgumentT();
-		}
+			_MethodDelegate( MethodType method )
+				: m_Method( method )
+			{
+			}
+
+			virtual DelegateType GetType() const HELIUM_OVERRIDE
+			{
+				return DelegateTypes::Method;
+			}
+
+			virtual bool Equals( const Delegate< void* >::DelegateImpl* rhs ) const HELIUM_OVERRIDE
+			{
+				return rhs == this;
+			}
+
+			virtual void Invoke( void* args ) const HELIUM_OVERRIDE
+			{
+				const MethodCall* call = static_cast< const MethodCall* >( args );
+				( static_cast< StructureT* >( call->m_Instance )->*m_Method )( *static_cast< ArgumentT* >( call->m_Argument ) );
+			}
+
+		private:
+			MethodType m_Method;
+		};
 	}
 }
 
@@ -186,13 +275,318 @@ Helium::Reflect::Method* Helium::Reflect::MetaStruct::AddMethod( void (Structure
 {
 	Method* m = AllocateMethod();
 	m->m_Name = name;
+	m->m_NameCrc = Crc32( name );
 	m->m_Translator = Reflect::AllocateTranslator< ArgumentT >();
-	typedef typename Delegate< void* >::DelegateImpl VoidDelegateT;
-	typedef typename Delegate< ArgumentT& >::template Method< StructureT > DelegateMethodT;
-	m->m_Delegate = reinterpret_cast< VoidDelegateT* >( new DelegateMethodT( NULL, method ) );
+	m->m_Delegate = new _MethodDelegate< StructureT, ArgumentT >( method );
 	return m;
 }
 
+namespace Helium
+{
+	namespace Reflect
+	{
+		// element-wise helpers, static arrays recurse into their elements
+
+		template< class T >
+		inline void _StaticAssignValue( T& left, const T& right )
+		{
+			left = right;
+		}
+
+		template< class T, size_t N >
+		inline void _StaticAssignValue( T (&left)[N], const T (&right)[N] )
+		{
+			for ( size_t i=0; i<N; ++i )
+			{
+				_StaticAssignValue( left[ i ], right[ i ] );
+			}
+		}
+
+		template< class T >
+		inline bool _StaticEqualsValue( const T& left, const T& right )
+		{
+			return left == right;
+		}
+
+		template< class T, size_t N >
+		inline bool _StaticEqualsValue( const T (&left)[N], const T (&right)[N] )
+		{
+			for ( size_t i=0; i<N; ++i )
+			{
+				if ( !_StaticEqualsValue( left[ i ], right[ i ] ) )
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		// FNV-1a over the bytes of a native value
+		template< class T >
+		inline uint32_t _StaticHashValue( const T& value, uint32_t hash )
+		{
+			const uint8_t* bytes = reinterpret_cast< const uint8_t* >( &value );
+			for ( size_t i=0; i<sizeof( T ); ++i )
+			{
+				hash = ( hash ^ bytes[ i ] ) * 16777619;
+			}
+			return hash;
+		}
+
+		// positive and negative zero compare equal, so they must hash equal
+		inline uint32_t _StaticHashValue( const float32_t& value, uint32_t hash )
+		{
+			const float32_t canonical = value == 0.f ? 0.f : value;
+			uint32_t bits;
+			MemoryCopy( &bits, &canonical, sizeof( bits ) );
+			return _StaticHashValue( bits, hash );
+		}
+
+		inline uint32_t _StaticHashValue( const float64_t& value, uint32_t hash )
+		{
+			const float64_t canonical = value == 0.0 ? 0.0 : value;
+			uint64_t bits;
+			MemoryCopy( &bits, &canonical, sizeof( bits ) );
+			return _StaticHashValue( bits, hash );
+		}
+
+		template< class T, size_t N >
+		inline uint32_t _StaticHashValue( const T (&value)[N], uint32_t hash )
+		{
+			for ( size_t i=0; i<N; ++i )
+			{
+				hash = _StaticHashValue( value[ i ], hash );
+			}
+			return hash;
+		}
+
+		// field list visitors, each instantiated once per structure so every field access is a constant offset
+
+		class _StaticFieldAdder
+		{
+		public:
+			_StaticFieldAdder( MetaStruct& structure )
+				: m_Structure( structure )
+			{
+			}
+
+			template< class OwnerT, class FieldT >
+			void operator()( FieldT OwnerT::* field, const char* name, uint32_t flags = 0 )
+			{
+				m_Structure.AddField( field, name, flags );
+			}
+
+		private:
+			MetaStruct& m_Structure;
+		};
+
+		template< class StructureT >
+		class _StaticFieldCopier
+		{
+		public:
+			_StaticFieldCopier( const StructureT& source, StructureT& destination )
+				: m_Source( source )
+				, m_Destination( destination )
+			{
+			}
+
+			template< class OwnerT, class FieldT >
+			void operator()( FieldT OwnerT::* field, const char* /*name*/, uint32_t /*flags*/ = 0 )
+			{
+				_StaticAssignValue( m_Destination.*field, m_Source.*field );
+			}
+
+		private:
+			const StructureT& m_Source;
+			StructureT&       m_Destination;
+		};
+
+		template< class StructureT >
+		class _StaticFieldComparer
+		{
+		public:
+			_StaticFieldComparer( const MetaStruct* structure, const StructureT& a, const StructureT& b )
+				: m_Structure( structure )
+				, m_A( a )
+				, m_B( b )
+				, m_Index( 0 )
+				, m_Equal( true )
+			{
+			}
+
+			template< class OwnerT, class FieldT >
+			void operator()( FieldT OwnerT::* field, const char* /*name*/, uint32_t /*flags*/ = 0 )
+			{
+				typedef typename std::remove_all_extents< FieldT >::type ElementT;
+				if ( m_Equal )
+				{
+					m_Equal = Compare( m_A.*field, m_B.*field, std::integral_constant< bool, std::is_arithmetic< ElementT >::value || std::is_enum< ElementT >::value >() );
+				}
+				++m_Index;
+			}
+
+			const MetaStruct* m_Structure;
+			const StructureT& m_A;
+			const StructureT& m_B;
+			uint32_t          m_Index; // of the field visited, the field table was added from the same list
+			bool              m_Equal;
+
+		private:
+			template< class FieldT >
+			bool Compare( const FieldT& a, const FieldT& b, std::true_type /*is_scalar*/ )
+			{
+				return _StaticEqualsValue( a, b );
+			}
+
+			// other values (like nested structures) may not have an operator==, so they compare through their translator
+			template< class FieldT >
+			bool Compare( const FieldT& /*a*/, const FieldT& /*b*/, std::false_type /*is_scalar*/ )
+			{
+				const Field* field = &m_Structure->m_Fields[ m_Index ];
+				for ( uint32_t i=0; i<field->m_Count; ++i )
+				{
+					Pointer a ( field, const_cast< StructureT* >( &m_A ), NULL, i );
+					Pointer b ( field, const_cast< StructureT* >( &m_B ), NULL, i );
+					if ( !field->m_Translator->Equals( a, b ) )
+					{
+						return false;
+					}
+				}
+				return true;
+			}
+		};
+
+		template< class StructureT >
+		class _StaticFieldHasher
+		{
+		public:
+			_StaticFieldHasher( const StructureT& composite, uint32_t hash )
+				: m_Composite( composite )
+				, m_Hash( hash )
+			{
+			}
+
+			template< class OwnerT, class FieldT >
+			void operator()( FieldT OwnerT::* field, const char* /*name*/, uint32_t /*flags*/ = 0 )
+			{
+				m_Hash = _StaticHashValue( m_Composite.*field, m_Hash );
+			}
+
+			const StructureT& m_Composite;
+			uint32_t          m_Hash;
+		};
+
+		template< class StructureT >
+		class _StaticFieldWriter
+		{
+		public:
+			_StaticFieldWriter( const StructureT& composite, Stream& stream )
+				: m_Composite( composite )
+				, m_Stream( stream )
+			{
+			}
+
+			template< class OwnerT, class FieldT >
+			void operator()( FieldT OwnerT::* field, const char* /*name*/, uint32_t flags = 0 )
+			{
+				if ( !( flags & FieldFlags::Discard ) )
+				{
+					m_Stream.Write( &( m_Composite.*field ), sizeof( FieldT ), 1 );
+				}
+			}
+
+		private:
+			const StructureT& m_Composite;
+			Stream&           m_Stream;
+		};
+
+		template< class StructureT >
+		class _StaticFieldReader
+		{
+		public:
+			_StaticFieldReader( StructureT& composite, Stream& stream )
+				: m_Composite( composite )
+				, m_Stream( stream )
+			{
+			}
+
+			template< class OwnerT, class FieldT >
+			void operator()( FieldT OwnerT::* field, const char* /*name*/, uint32_t flags = 0 )
+			{
+				if ( !( flags & FieldFlags::Discard ) )
+				{
+					m_Stream.Read( &( m_Composite.*field ), sizeof( FieldT ), 1 );
+				}
+			}
+
+		private:
+			StructureT& m_Composite;
+			Stream&     m_Stream;
+		};
+
+		template< class StructureT >
+		void _StaticCopy( const void* source, void* destination )
+		{
+			_StaticFieldCopier< StructureT > copier ( *static_cast< const StructureT* >( source ), *static_cast< StructureT* >( destination ) );
+			StructureT::VisitStaticFields( copier );
+		}
+
+		template< class StructureT >
+		bool _StaticEquals( const MetaStruct* structure, const void* a, const void* b )
+		{
+			_StaticFieldComparer< StructureT > comparer ( structure, *static_cast< const StructureT* >( a ), *static_cast< const StructureT* >( b ) );
+			StructureT::VisitStaticFields( comparer );
+			return comparer.m_Equal;
+		}
+
+		template< class StructureT >
+		uint32_t _StaticHash( const void* composite, uint32_t hash )
+		{
+			_StaticFieldHasher< StructureT > hasher ( *static_cast< const StructureT* >( composite ), hash );
+			StructureT::VisitStaticFields( hasher );
+			return hasher.m_Hash;
+		}
+
+		template< class StructureT >
+		void _StaticWrite( const void* composite, Stream& stream )
+		{
+			_StaticFieldWriter< StructureT > writer ( *static_cast< const StructureT* >( composite ), stream );
+			StructureT::VisitStaticFields( writer );
+		}
+
+		template< class StructureT >
+		void _StaticRead( void* composite, Stream& stream )
+		{
+			_StaticFieldReader< StructureT > reader ( *static_cast< StructureT* >( composite ), stream );
+			StructureT::VisitStaticFields( reader );
+		}
+	}
+}
+
+template < class StructureT >
+void Helium::Reflect::MetaStruct::AddStaticFields()
+{
+	// the generated operations stand in for the whole field table, so the list must describe every field
+	HELIUM_ASSERT( m_Fields.IsEmpty() );
+	const bool complete = m_Fields.IsEmpty();
+
+	_StaticFieldAdder adder ( *this );
+	StructureT::VisitStaticFields( adder );
+
+	if ( !complete )
+	{
+		return;
+	}
+
+	StaticOperations operations;
+	operations.m_Copy = &_StaticCopy< StructureT >;
+	operations.m_Equals = &_StaticEquals< StructureT >;
+	operations.m_Hash = &_StaticHash< StructureT >;
+	operations.m_Write = &_StaticWrite< StructureT >;
+	operations.m_Read = &_StaticRead< StructureT >;
+	SetStaticOperations( operations );
+}
+
 //
 // MetaStructRegistrar
 //
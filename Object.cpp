@@ -1,25 +1,66 @@
 #include "ReflectPch.h"
 #include "Reflect/Object.h"
 
+#include "Platform/Atomic.h"
+#include "Platform/Locks.h"
+#include "Platform/Thread.h"
+
 #include "Foundation/Log.h"
 #include "Foundation/ObjectPool.h"
 
 #include "Reflect/Registry.h"
+#include "Reflect/Dispatch.h"
 #include "Reflect/MetaClass.h"
+#include "Reflect/ObjectChanges.h"
+#include "Reflect/ObjectSampling.h"
 #include "Reflect/Registry.h"
 #include "Reflect/TranslatorDeduction.h"
 
 using namespace Helium;
 using namespace Helium::Reflect;
 
+/// Storage of a reference count proxy, either pooled or placed in front of the object it was allocated with.
+///
+/// The inline hold count shares the tail padding of the proxy where the ABI allows it.
+struct ObjectRefCountProxySlot : public RefCountProxy< Object >
+{
+	/// Zero for pooled proxies, otherwise the number of users (the object, and the proxy once bound) of the memory.
+	volatile int32_t inlineHolds;
+};
+
+/// Bytes in front of an object of a class with an inline proxy, keeping the object SIMD aligned.
+static const size_t INLINE_PROXY_HEADER_SIZE =
+	( sizeof( ObjectRefCountProxySlot ) + HELIUM_SIMD_ALIGNMENT - 1 ) & ~static_cast< size_t >( HELIUM_SIMD_ALIGNMENT - 1 );
+
 /// Static reference count proxy management data.
 struct ObjectRefCountSupport::StaticTranslator
 {
 	/// Number of proxy objects to allocate per block for the proxy pool.
 	static const size_t POOL_BLOCK_SIZE = 1024 * 2048;
 
+	/// Number of proxies moved between a thread's magazine and the proxy pool at a time.
+	static const uint32_t MAGAZINE_BATCH_SIZE = 64;
+	/// Number of proxies a thread's magazine holds before it returns a batch to the proxy pool.
+	static const uint32_t MAGAZINE_CAPACITY = MAGAZINE_BATCH_SIZE * 2;
+
+	/// Proxies cached by a single thread.
+	struct Magazine
+	{
+		uint32_t count;
+		ObjectRefCountProxySlot* proxies[ MAGAZINE_CAPACITY ];
+
+		/// Inline proxy of the object most recently allocated by the thread, until its construction begins.
+		ObjectRefCountProxySlot* pPendingInline;
+		/// Inline proxy to hand out from the next allocation, set while binding it to its object.
+		ObjectRefCountProxySlot* pBindingInline;
+	};
+
 	/// Proxy object pool.
-	ObjectPool< RefCountProxy< Object > > proxyPool;
+	ObjectPool< ObjectRefCountProxySlot > proxyPool;
+	/// Lock held while moving a batch of proxies to or from the proxy pool.
+	Mutex proxyPoolLock;
+	/// Magazine of the calling thread, returned to the proxy pool when the thread exits.
+	ThreadLocalPointer magazine;
 #if HELIUM_ENABLE_MEMORY_TRACKING
 	/// Active reference count proxies.
 	ConcurrentHashSet< RefCountProxy< Object >* > activeProxySet;
@@ -29,34 +70,129 @@ struct ObjectRefCountSupport::StaticTranslator
 	//@{
 	StaticTranslator();
 	//@}
+
+	Magazine* GetMagazine();
+	static void ReleaseMagazine( void* pMagazine );
+};
+
+ObjectRefCountSupport::StaticTranslator* volatile ObjectRefCountSupport::sm_pStaticTranslator = NULL;
+
+// the map of the graph being cloned on each thread
+static ThreadLocalPointer g_CurrentObjectCloneMap;
+
+// makes a map the calling thread's current one for its lifetime, restoring the previous one even if a copy throws
+class ObjectCloneMapScope : NonCopyable
+{
+public:
+	ObjectCloneMapScope( ObjectCloneMap* clones )
+		: m_Previous( g_CurrentObjectCloneMap.GetPointer() )
+	{
+		g_CurrentObjectCloneMap.SetPointer( clones );
+	}
+
+	~ObjectCloneMapScope()
+	{
+		g_CurrentObjectCloneMap.SetPointer( m_Previous );
+	}
+
+private:
+	void* m_Previous;
 };
 
-ObjectRefCountSupport::StaticTranslator* ObjectRefCountSupport::sm_pStaticTranslator = NULL;
+// the dirty fields of the objects tracking them, split by address so changes to different objects rarely
+//  wait on the same lock (each shard is kept on its own cache lines)
+struct HELIUM_ALIGN_PRE( 64 ) ObjectDirtyFieldsShard
+{
+	HashMap< const Object*, FieldBitSet > m_Fields;
+	Mutex                                 m_Lock;
+} HELIUM_ALIGN_POST( 64 );
+
+static const size_t           OBJECT_DIRTY_FIELDS_SHARDS = 64;
+static ObjectDirtyFieldsShard g_ObjectDirtyFields[ OBJECT_DIRTY_FIELDS_SHARDS ];
+
+static ObjectDirtyFieldsShard& GetObjectDirtyFieldsShard( const Object* object )
+{
+	// the low bits of an object's address are alignment, fold the bits above them
+	uintptr_t address = reinterpret_cast< uintptr_t >( object ) >> 4;
+	return g_ObjectDirtyFields[ ( address ^ ( address >> 6 ) ^ ( address >> 12 ) ) % OBJECT_DIRTY_FIELDS_SHARDS ];
+}
 
 uint32_t Object::s_DefaultPointerFlags = 0x0;
 const MetaClass* Object::s_MetaClass = NULL;
 MetaClassRegistrar< Object, void > Object::s_Registrar( TXT("Object") );
 
-/// Retrieve a reference count proxy from the global pool.
+/// Retrieve the proxy management data, creating it on first use.
+///
+/// Threads racing to create it each build an instance, but only the first one published is kept.
+///
+/// @return  Static proxy management data.
+ObjectRefCountSupport::StaticTranslator* ObjectRefCountSupport::GetStaticTranslator()
+{
+	StaticTranslator* pStaticTranslator = sm_pStaticTranslator;
+	if( !pStaticTranslator )
+	{
+		StaticTranslator* pNewStaticTranslator = new StaticTranslator;
+		HELIUM_ASSERT( pNewStaticTranslator );
+
+		pStaticTranslator = AtomicCompareExchangeRelease( sm_pStaticTranslator, pNewStaticTranslator, static_cast< StaticTranslator* >( NULL ) );
+		if( pStaticTranslator )
+		{
+			delete pNewStaticTranslator;
+		}
+		else
+		{
+			pStaticTranslator = pNewStaticTranslator;
+		}
+	}
+
+	return pStaticTranslator;
+}
+
+/// Drop a hold on the memory of an object allocated with an inline proxy, freeing it once the object is destroyed
+/// and its proxy is released.
+///
+/// @param[in] pSlot  Inline proxy at the start of the memory.
+static void ReleaseInlineHold( ObjectRefCountProxySlot* pSlot )
+{
+	if( AtomicDecrementRelease( pSlot->inlineHolds ) == 0 )
+	{
+		Helium::DefaultAllocator allocator;
+		allocator.FreeAligned( pSlot );
+	}
+}
+
+/// Retrieve a reference count proxy from the calling thread's magazine, refilling it from the global pool if empty.
 ///
 /// @return  Pointer to a reference count proxy.
 ///
 /// @see Release()
 RefCountProxy< Object >* ObjectRefCountSupport::Allocate()
 {
-	// Lazy initialization of the proxy management data.  Even though this isn't thread-safe, it should still be fine as
-	// the proxy system should be initialized from the main thread before any sub-threads are spawned (i.e. during
-	// startup type initialization).
-	StaticTranslator* pStaticTranslator = sm_pStaticTranslator;
-	if( !pStaticTranslator )
+	StaticTranslator* pStaticTranslator = GetStaticTranslator();
+	StaticTranslator::Magazine* pMagazine = pStaticTranslator->GetMagazine();
+
+	ObjectRefCountProxySlot* pProxy = pMagazine->pBindingInline;
+	if( pProxy )
 	{
-		pStaticTranslator = new StaticTranslator;
-		HELIUM_ASSERT( pStaticTranslator );
-		sm_pStaticTranslator = pStaticTranslator;
+		pMagazine->pBindingInline = NULL;
 	}
+	else
+	{
+		if( pMagazine->count == 0 )
+		{
+			MutexScopeLock lock( pStaticTranslator->proxyPoolLock );
+			for( uint32_t proxyIndex = 0; proxyIndex < StaticTranslator::MAGAZINE_BATCH_SIZE; ++proxyIndex )
+			{
+				ObjectRefCountProxySlot* pPooledProxy = pStaticTranslator->proxyPool.Allocate();
+				HELIUM_ASSERT( pPooledProxy );
+				pPooledProxy->inlineHolds = 0;
+				pMagazine->proxies[ pMagazine->count++ ] = pPooledProxy;
+			}
+		}
 
-	RefCountProxy< Object >* pProxy = pStaticTranslator->proxyPool.Allocate();
-	HELIUM_ASSERT( pProxy );
+		pProxy = pMagazine->proxies[ --pMagazine->count ];
+		HELIUM_ASSERT( pProxy );
+	}
 
 #if HELIUM_ENABLE_MEMORY_TRACKING
 	ConcurrentHashSet< RefCountProxy< Object >* >::Accessor activeProxySetAccessor;
@@ -66,7 +202,7 @@ RefCountProxy< Object >* ObjectRefCountSupport::Allocate()
 	return pProxy;
 }
 
-/// Release a reference count proxy back to the global pool.
+/// Release a reference count proxy to the calling thread's magazine, returning a batch to the global pool if full.
 ///
 /// @param[in] pProxy  Pointer to the reference count proxy to release.
 ///
@@ -82,7 +218,135 @@ void ObjectRefCountSupport::Release( RefCountProxy< Object >* pProxy )
 	HELIUM_VERIFY( pStaticTranslator->activeProxySet.Remove( pProxy ) );
 #endif
 
-	pStaticTranslator->proxyPool.Release( pProxy );
+	// inline proxies go away with the memory of the object they were allocated with
+	ObjectRefCountProxySlot* pSlot = static_cast< ObjectRefCountProxySlot* >( pProxy );
+	if( pSlot->inlineHolds )
+	{
+		ReleaseInlineHold( pSlot );
+		return;
+	}
+
+	StaticTranslator::Magazine* pMagazine = pStaticTranslator->GetMagazine();
+	if( pMagazine->count == StaticTranslator::MAGAZINE_CAPACITY )
+	{
+		MutexScopeLock lock( pStaticTranslator->proxyPoolLock );
+		for( uint32_t proxyIndex = 0; proxyIndex < StaticTranslator::MAGAZINE_BATCH_SIZE; ++proxyIndex )
+		{
+			pStaticTranslator->proxyPool.Release( pMagazine->proxies[ --pMagazine->count ] );
+		}
+	}
+
+	pMagazine->proxies[ pMagazine->count++ ] = pSlot;
+}
+
+/// Return the proxies cached by the calling thread to the global pool.
+///
+/// This happens on its own when a thread exits, threads that stay around may call it to give their proxies back
+/// early.
+void ObjectRefCountSupport::ReleaseThreadCache()
+{
+	StaticTranslator* pStaticTranslator = sm_pStaticTranslator;
+	if( !pStaticTranslator )
+	{
+		return;
+	}
+
+	void* pMagazine = pStaticTranslator->magazine.GetPointer();
+	if( pMagazine )
+	{
+		pStaticTranslator->magazine.SetPointer( NULL );
+		StaticTranslator::ReleaseMagazine( pMagazine );
+	}
+}
+
+/// Allocate memory for an object of a class with an inline proxy, with the proxy in front of it.
+///
+/// The proxy is bound to the object when Object's constructor runs (see BindInline()), and the memory is freed once
+/// the object is destroyed and the proxy is released, so weak references may outlive the object as usual.  This
+/// saves the proxy allocation and keeps the reference counts next to the object.
+///
+/// @param[in] bytes  Size of the object.
+///
+/// @return  Memory for the object.
+///
+/// @see FreeInline(), BindInline()
+void* ObjectRefCountSupport::AllocateInline( size_t bytes )
+{
+	Helium::DefaultAllocator allocator;
+	ObjectRefCountProxySlot* pSlot = static_cast< ObjectRefCountProxySlot* >(
+		allocator.AllocateAligned( HELIUM_SIMD_ALIGNMENT, INLINE_PROXY_HEADER_SIZE + bytes ) );
+	HELIUM_ASSERT( pSlot );
+	pSlot->inlineHolds = 1;
+
+	GetStaticTranslator()->GetMagazine()->pPendingInline = pSlot;
+
+	return reinterpret_cast< char* >( pSlot ) + INLINE_PROXY_HEADER_SIZE;
+}
+
+/// Free the memory of an object allocated by AllocateInline().
+///
+/// The memory is kept until the inline proxy is released if it's bound.
+///
+/// @param[in] pObjectMemory  Memory of the object.
+///
+/// @see AllocateInline()
+void ObjectRefCountSupport::FreeInline( void* pObjectMemory )
+{
+	if( !pObjectMemory )
+	{
+		return;
+	}
+
+	ObjectRefCountProxySlot* pSlot = reinterpret_cast< ObjectRefCountProxySlot* >( static_cast< char* >( pObjectMemory ) - INLINE_PROXY_HEADER_SIZE );
+
+	// construction may have failed before the proxy was bound
+	StaticTranslator* pStaticTranslator = sm_pStaticTranslator;
+	if( pStaticTranslator )
+	{
+		StaticTranslator::Magazine* pMagazine = static_cast< StaticTranslator::Magazine* >( pStaticTranslator->magazine.GetPointer() );
+		if( pMagazine && pMagazine->pPendingInline == pSlot )
+		{
+			pMagazine->pPendingInline = NULL;
+		}
+	}
+
+	ReleaseInlineHold( pSlot );
+}
+
+/// Bind the inline proxy allocated in front of an object under construction.
+///
+/// Does nothing for objects not allocated by AllocateInline() on this thread, or whose construction began after the
+/// construction of another inline object (those simply use a pooled proxy).
+///
+/// @param[in] pObject  Object under construction.
+///
+/// @see AllocateInline()
+void ObjectRefCountSupport::BindInline( Object* pObject )
+{
+	StaticTranslator* pStaticTranslator = sm_pStaticTranslator;
+	if( !pStaticTranslator )
+	{
+		return;
+	}
+
+	StaticTranslator::Magazine* pMagazine = static_cast< StaticTranslator::Magazine* >( pStaticTranslator->magazine.GetPointer() );
+	if( !pMagazine || !pMagazine->pPendingInline )
+	{
+		return;
+	}
+
+	ObjectRefCountProxySlot* pSlot = pMagazine->pPendingInline;
+	if( reinterpret_cast< char* >( pSlot ) + INLINE_PROXY_HEADER_SIZE != reinterpret_cast< char* >( pObject ) )
+	{
+		return;
+	}
+
+	pMagazine->pPendingInline = NULL;
+
+	// the proxy now holds the memory too
+	pSlot->inlineHolds = 2;
+	pMagazine->pBindingInline = pSlot;
+	HELIUM_VERIFY( pObject->GetRefCountProxy() == pSlot );
 }
 
 /// Release the name table and free all allocated memory.
@@ -118,6 +382,8 @@ void ObjectRefCountSupport::Shutdown()
 	}
 #endif  // HELIUM_ENABLE_MEMORY_TRACKING
 
+	ReleaseThreadCache();
+
 	delete sm_pStaticTranslator;
 	sm_pStaticTranslator = NULL;
 }
@@ -160,21 +426,102 @@ bool ObjectRefCountSupport::GetFirstActiveProxy(
 /// Constructor.
 ObjectRefCountSupport::StaticTranslator::StaticTranslator()
 : proxyPool( POOL_BLOCK_SIZE )
+, magazine( &ReleaseMagazine )
 {
 }
 
+/// Retrieve the proxy magazine of the calling thread, creating it on first use.
+///
+/// @return  Magazine of the calling thread.
+ObjectRefCountSupport::StaticTranslator::Magazine* ObjectRefCountSupport::StaticTranslator::GetMagazine()
+{
+	Magazine* pMagazine = static_cast< Magazine* >( magazine.GetPointer() );
+	if( !pMagazine )
+	{
+		pMagazine = new Magazine;
+		HELIUM_ASSERT( pMagazine );
+		pMagazine->count = 0;
+		pMagazine->pPendingInline = NULL;
+		pMagazine->pBindingInline = NULL;
+		magazine.SetPointer( pMagazine );
+	}
+
+	return pMagazine;
+}
+
+/// Return the proxies of a thread's magazine to the proxy pool and free it.
+///
+/// @param[in] pMagazine  Magazine of a thread that exited or released its cache.
+void ObjectRefCountSupport::StaticTranslator::ReleaseMagazine( void* pMagazine )
+{
+	StaticTranslator* pStaticTranslator = sm_pStaticTranslator;
+	HELIUM_ASSERT( pStaticTranslator );
+
+	Magazine* pThreadMagazine = static_cast< Magazine* >( pMagazine );
+	{
+		MutexScopeLock lock( pStaticTranslator->proxyPoolLock );
+		while( pThreadMagazine->count )
+		{
+			pStaticTranslator->proxyPool.Release( pThreadMagazine->proxies[ --pThreadMagazine->count ] );
+		}
+	}
+
+	delete pThreadMagazine;
+}
+
 Object::Object()
+	: m_ObjectFlags( 0 )
 {
+	ObjectRefCountSupport::BindInline( this );
 
+	if ( ObjectSampler::GetInterval() && ObjectSampler::Construct( this ) )
+	{
+		AtomicOrRelease( m_ObjectFlags, ObjectFlags::Sampled );
+	}
+}
+
+Object::Object( const Object& /*source*/ )
+	: NonCopyable()
+	, m_ObjectFlags( 0 )
+{
+	ObjectRefCountSupport::BindInline( this );
+
+	if ( ObjectSampler::GetInterval() && ObjectSampler::Construct( this ) )
+	{
+		AtomicOrRelease( m_ObjectFlags, ObjectFlags::Sampled );
+	}
 }
 
 Object::~Object()
 {
+	if ( m_ObjectFlags & ObjectFlags::Sampled )
+	{
+		ObjectSampler::Destruct( this );
+	}
+
+	if ( m_ObjectFlags & ObjectFlags::DirtyFields )
+	{
+		TrackDirtyFields( false );
+	}
 
+	if ( m_ObjectFlags & ObjectFlags::Listened )
+	{
+		ObjectChangeListeners::Destruct( this );
+	}
 }
 
 void* Object::operator new( size_t bytes )
 {
+	ObjectArena* arena = ObjectArena::GetCurrent();
+	if ( arena )
+	{
+		void* memory = arena->Allocate( bytes );
+		if ( memory )
+		{
+			return memory;
+		}
+	}
+
 	Helium::DefaultAllocator allocator;
 	void* memory = allocator.AllocateAligned( HELIUM_SIMD_ALIGNMENT, bytes );
 	return memory;
@@ -187,6 +534,13 @@ void* Object::operator new( size_t /*bytes*/, void* memory )
 
 void Object::operator delete( void *ptr, size_t bytes )
 {
+	// arena memory is reclaimed all at once when the arena is released
+	if ( ObjectArena::Contains( ptr ) )
+	{
+		ObjectArena::Free( ptr );
+		return;
+	}
+
 	Helium::DefaultAllocator allocator;
 	allocator.FreeAligned( ptr );
 }
@@ -195,6 +549,11 @@ void Object::operator delete( void* /*ptr*/, void* /*memory*/ )
 {
 }
 
+bool Object::IsSampled() const
+{
+	return ( m_ObjectFlags & ObjectFlags::Sampled ) != 0;
+}
+
 /// Perform any necessary work immediately prior to destroying this object.
 ///
 /// Note that the parent-class implementation should always be chained last.
@@ -313,23 +672,502 @@ void Object::CopyTo( Object* object )
 	}
 }
 
-ObjectPtr Object::Clone()
+// copy the data of an object into a new instance of its class, with the callbacks cloning makes
+static void CloneData( Object* source, Object* clone, bool shallow = false )
 {
-	ObjectPtr clone = GetMetaClass()->m_Creator();
-
-	PreSerialize( NULL );
+	source->PreSerialize( NULL );
 	clone->PreDeserialize( NULL );
 
-	const MetaClass* type = GetMetaClass();
-	type->Copy( this, this, clone, clone );
+	const MetaClass* type = source->GetMetaClass();
+	type->Copy( source, source, clone, clone, shallow );
 
 	clone->PostDeserialize( NULL );
-	PostSerialize( NULL );
+	source->PostSerialize( NULL );
+}
 
+ObjectPtr Object::Clone()
+{
+	const MetaClass* type = GetMetaClass();
+	if ( type->m_Copier )
+	{
+		// the copy is constructed with its data, so it only gets the callback after deserializing
+		PreSerialize( NULL );
+		ObjectPtr clone = type->m_Copier( this );
+		clone->PostDeserialize( NULL );
+		PostSerialize( NULL );
+		return clone;
+	}
+
+	ObjectPtr clone = type->m_Creator();
+	CloneData( this, clone );
 	return clone;
 }
 
+ObjectPtr Object::CloneGraph()
+{
+	ObjectCloneMap clones;
+	return clones.Clone( this );
+}
+
+ObjectPtr Object::CloneOnWrite()
+{
+	// the objects an unfrozen source references can change underneath the clone, so they can't be shared
+	if ( !( m_ObjectFlags & ObjectFlags::Frozen ) )
+	{
+		return CloneGraph();
+	}
+
+	// abstract classes have no creator
+	const MetaClass* type = GetMetaClass();
+	HELIUM_ASSERT( type->m_Creator );
+	ObjectPtr clone = type->m_Creator();
+	if ( !clone )
+	{
+		return NULL;
+	}
+
+	CloneData( this, clone, true );
+	AtomicOrRelease( clone->m_ObjectFlags, ObjectFlags::CopyOnWrite );
+	return clone;
+}
+
+void Object::Materialize()
+{
+	// only the caller that clears the flag materializes
+	if ( !( AtomicAndRelease( m_ObjectFlags, ~ObjectFlags::CopyOnWrite ) & ObjectFlags::CopyOnWrite ) )
+	{
+		return;
+	}
+
+	// deep copy into a scratch instance through a clone map (so references shared among the objects stay shared),
+	//  then take the data back
+	const MetaClass* type = GetMetaClass();
+	ObjectPtr scratch = type->m_Creator();
+	{
+		ObjectCloneMap clones;
+		ObjectCloneMapScope scope ( &clones );
+		type->Copy( this, this, scratch, scratch );
+	}
+	type->Move( scratch, scratch, this, this );
+}
+
+bool Object::IsCopyOnWrite() const
+{
+	return ( m_ObjectFlags & ObjectFlags::CopyOnWrite ) != 0;
+}
+
+bool Object::IsFrozen() const
+{
+	return ( m_ObjectFlags & ObjectFlags::Frozen ) != 0;
+}
+
+void Object::RefuseChange( const Field* field ) const
+{
+	Log::Warning( TXT( "Change to field '%s' of a frozen %s refused\n" ), field ? field->m_Name : TXT( "(unknown)" ), GetMetaClass()->m_Name );
+}
+
 void Object::RaiseChanged( const Field* field ) const
 {
-	e_Changed.Raise( ObjectChangeArgs( this, field ) );
+	if ( m_ObjectFlags & ObjectFlags::Frozen )
+	{
+		RefuseChange( field );
+		return;
+	}
+
+	if ( m_ObjectFlags & ObjectFlags::CopyOnWrite )
+	{
+		const_cast< Object* >( this )->Materialize();
+	}
+
+	if ( m_ObjectFlags & ObjectFlags::DirtyFields )
+	{
+		ObjectDirtyFieldsShard& shard = GetObjectDirtyFieldsShard( this );
+		MutexScopeLock lock ( shard.m_Lock );
+		HashMap< const Object*, FieldBitSet >::Iterator found = shard.m_Fields.Find( this );
+
+		// tracking may have stopped on another thread since the flag was tested
+		if ( found != shard.m_Fields.End() )
+		{
+			if ( field )
+			{
+				found->Second().Set( field->m_Index );
+			}
+			else
+			{
+				for ( const MetaStruct* type = GetMetaClass(); type; type = type->m_Base )
+				{
+					for ( size_t i=0; i<type->m_Fields.GetSize(); ++i )
+					{
+						found->Second().Set( type->m_Fields[ i ].m_Index );
+					}
+				}
+			}
+		}
+	}
+
+	if ( !( m_ObjectFlags & ObjectFlags::Listened ) )
+	{
+		return;
+	}
+
+	ObjectChangeTransaction* transaction = ObjectChangeTransaction::GetCurrent();
+	if ( transaction )
+	{
+		transaction->Record( this, field );
+		return;
+	}
+
+	ObjectChangeListeners::Raise( ObjectChangeArgs( this, field ) );
+}
+
+void Object::AddChangedListener( const ObjectChangeSignature::Delegate& listener ) const
+{
+	ObjectChangeListeners::Add( this, listener );
+	AtomicOrRelease( m_ObjectFlags, ObjectFlags::Listened );
+}
+
+void Object::RemoveChangedListener( const ObjectChangeSignature::Delegate& listener ) const
+{
+	if ( m_ObjectFlags & ObjectFlags::Listened )
+	{
+		ObjectChangeListeners::Remove( this, listener );
+	}
+}
+
+void Object::TrackDirtyFields( bool track )
+{
+	if ( track == IsTrackingDirtyFields() )
+	{
+		return;
+	}
+
+	// checked again under the lock, so racing calls add or remove the entry once
+	ObjectDirtyFieldsShard& shard = GetObjectDirtyFieldsShard( this );
+	MutexScopeLock lock ( shard.m_Lock );
+	if ( track == IsTrackingDirtyFields() )
+	{
+		return;
+	}
+
+	if ( track )
+	{
+		shard.m_Fields.Insert( HashMap< const Object*, FieldBitSet >::ValueType( this, FieldBitSet() ) );
+		AtomicOrRelease( m_ObjectFlags, ObjectFlags::DirtyFields );
+	}
+	else
+	{
+		HELIUM_VERIFY( shard.m_Fields.Remove( this ) );
+		AtomicAndRelease( m_ObjectFlags, ~ObjectFlags::DirtyFields );
+	}
+}
+
+bool Object::IsTrackingDirtyFields() const
+{
+	return ( m_ObjectFlags & ObjectFlags::DirtyFields ) != 0;
+}
+
+bool Object::GetDirtyFields( FieldBitSet& fields ) const
+{
+	fields.Clear();
+
+	if ( m_ObjectFlags & ObjectFlags::DirtyFields )
+	{
+		ObjectDirtyFieldsShard& shard = GetObjectDirtyFieldsShard( this );
+		MutexScopeLock lock ( shard.m_Lock );
+		HashMap< const Object*, FieldBitSet >::Iterator found = shard.m_Fields.Find( this );
+		if ( found != shard.m_Fields.End() )
+		{
+			fields = found->Second();
+		}
+	}
+
+	return !fields.IsEmpty();
+}
+
+bool Object::IsFieldDirty( const Field* field ) const
+{
+	if ( !( m_ObjectFlags & ObjectFlags::DirtyFields ) )
+	{
+		return false;
+	}
+
+	ObjectDirtyFieldsShard& shard = GetObjectDirtyFieldsShard( this );
+	MutexScopeLock lock ( shard.m_Lock );
+	HashMap< const Object*, FieldBitSet >::Iterator found = shard.m_Fields.Find( this );
+	return found != shard.m_Fields.End() && found->Second().Test( field->m_Index );
+}
+
+void Object::ClearDirtyFields()
+{
+	if ( m_ObjectFlags & ObjectFlags::DirtyFields )
+	{
+		ObjectDirtyFieldsShard& shard = GetObjectDirtyFieldsShard( this );
+		MutexScopeLock lock ( shard.m_Lock );
+		HashMap< const Object*, FieldBitSet >::Iterator found = shard.m_Fields.Find( this );
+		if ( found != shard.m_Fields.End() )
+		{
+			found->Second().Clear();
+		}
+	}
+}
+
+// finds the objects referenced (and deep copied) by the data of an object
+class ObjectReferenceCollector : public Visitor
+{
+public:
+	ObjectReferenceCollector( DynamicArray< Object* >& references )
+		: m_References( references )
+	{
+	}
+
+	virtual bool VisitField( const Field* field, Pointer pointer ) HELIUM_OVERRIDE
+	{
+		// shared fields copy their references
+		if ( field->m_Flags & FieldFlags::Share )
+		{
+			return false;
+		}
+
+		return Collect( pointer, field->m_Translator.Ptr() );
+	}
+
+	virtual bool VisitItem( Pointer item, Translator* translator ) HELIUM_OVERRIDE
+	{
+		return Collect( item, translator );
+	}
+
+	virtual bool VisitPair( Pointer key, ScalarTranslator* keyTranslator, Pointer value, Translator* valueTranslator ) HELIUM_OVERRIDE
+	{
+		Collect( key, keyTranslator );
+		return Collect( value, valueTranslator );
+	}
+
+private:
+	bool Collect( Pointer pointer, Translator* translator )
+	{
+		if ( !translator->IsA( MetaIds::PointerTranslator ) )
+		{
+			return true;
+		}
+
+		// every StrongPtr has the same layout, whatever it points to
+		Object* object = pointer.As< ObjectPtr >().Ptr();
+		if ( object )
+		{
+			m_References.Add( object );
+		}
+		return false;
+	}
+
+	DynamicArray< Object* >& m_References;
+};
+
+void Object::Freeze()
+{
+	SetFrozen( true );
+}
+
+void Object::Thaw()
+{
+	SetFrozen( false );
+}
+
+void Object::SetFrozen( bool freeze )
+{
+	// objects are changed before what they reference is visited, so cycles and objects changed already end the walk
+	DynamicArray< Object* > pending;
+	DynamicArray< Object* > references;
+	ObjectReferenceCollector collector ( references );
+
+	pending.Add( this );
+	while ( !pending.IsEmpty() )
+	{
+		Object* object = pending.GetLast();
+		pending.Pop();
+		int32_t previous = freeze ? AtomicOrRelease( object->m_ObjectFlags, ObjectFlags::Frozen ) : AtomicAndRelease( object->m_ObjectFlags, ~ObjectFlags::Frozen );
+		if ( ( ( previous & ObjectFlags::Frozen ) != 0 ) == freeze )
+		{
+			continue;
+		}
+
+		references.Clear();
+		object->GetMetaClass()->Visit( object, object, collector );
+		pending.AddArray( references.GetData(), references.GetSize() );
+	}
+}
+
+// the sources and clones of a graph copied in parallel
+struct ObjectCloneWork
+{
+	ObjectCloneMap*           m_Clones;
+	DynamicArray< Object* >*  m_Sources;
+	DynamicArray< Object* >*  m_Destinations;
+};
+
+static void CopyCloneData( void* context, size_t begin, size_t end )
+{
+	ObjectCloneWork& work = *static_cast< ObjectCloneWork* >( context );
+
+	ObjectCloneMapScope scope ( work.m_Clones );
+	for ( size_t i=begin; i<end; ++i )
+	{
+		Object* source = ( *work.m_Sources )[ i ];
+		source->GetMetaClass()->Copy( source, source, ( *work.m_Destinations )[ i ], ( *work.m_Destinations )[ i ] );
+	}
+}
+
+ObjectCloneMap::SealScope::SealScope( ObjectCloneMap& clones )
+	: m_Clones( clones )
+{
+	HELIUM_ASSERT( !m_Clones.m_Sealed );
+	m_Clones.m_Sealed = true;
+}
+
+ObjectCloneMap::SealScope::~SealScope()
+{
+	m_Clones.m_Sealed = false;
+}
+
+ObjectCloneMap::ObjectCloneMap()
+	: m_Sealed( false )
+{
+}
+
+ObjectCloneMap::~ObjectCloneMap()
+{
+	HELIUM_ASSERT( GetCurrent() != this );
+}
+
+ObjectPtr ObjectCloneMap::Clone( Object* source )
+{
+	if ( !source )
+	{
+		return NULL;
+	}
+
+	HashMap< Object*, ObjectPtr >::Iterator found = m_Clones.Find( source );
+	if ( found != m_Clones.End() )
+	{
+		return found->Second();
+	}
+
+	HELIUM_ASSERT( !m_Sealed );
+
+	// remember the clone before copying into it, so references back to the source (cycles) find it
+	ObjectPtr clone = source->GetMetaClass()->m_Creator();
+	m_Clones.Insert( HashMap< Object*, ObjectPtr >::ValueType( source, clone ) );
+
+	{
+		ObjectCloneMapScope scope ( this );
+		CloneData( source, clone );
+	}
+
+	return clone;
+}
+
+ObjectPtr ObjectCloneMap::CloneParallel( Object* source, uint32_t threadCount )
+{
+	if ( !source )
+	{
+		return NULL;
+	}
+
+	HELIUM_ASSERT( GetCurrent() != this );
+
+	// find the objects not cloned yet, breadth first, and create their clones
+	DynamicArray< Object* > sources;
+	DynamicArray< Object* > destinations;
+	DynamicArray< Object* > references;
+	ObjectReferenceCollector collector ( references );
+
+	references.Add( source );
+	for ( size_t i=0; ; ++i )
+	{
+		for ( size_t j=0; j<references.GetSize(); ++j )
+		{
+			Object* reference = references[ j ];
+			if ( !Find( reference ) )
+			{
+				ObjectPtr clone = reference->GetMetaClass()->m_Creator();
+				m_Clones.Insert( HashMap< Object*, ObjectPtr >::ValueType( reference, clone ) );
+				sources.Add( reference );
+				destinations.Add( clone );
+			}
+		}
+
+		if ( i == sources.GetSize() )
+		{
+			break;
+		}
+
+		references.Clear();
+		sources[ i ]->GetMetaClass()->Visit( sources[ i ], sources[ i ], collector );
+	}
+
+	for ( size_t i=0; i<sources.GetSize(); ++i )
+	{
+		sources[ i ]->PreSerialize( NULL );
+		destinations[ i ]->PreDeserialize( NULL );
+	}
+
+	// every pointer copied now finds its clone in the map, which isn't changed until the copies are done
+	{
+		SealScope seal ( *this );
+		ObjectCloneWork work = { this, &sources, &destinations };
+		ForEachParallel( sources.GetSize(), threadCount, &CopyCloneData, &work );
+	}
+
+	for ( size_t i=sources.GetSize(); i>0; --i )
+	{
+		destinations[ i - 1 ]->PostDeserialize( NULL );
+		sources[ i - 1 ]->PostSerialize( NULL );
+	}
+
+	return Find( source );
+}
+
+Object* ObjectCloneMap::Find( Object* source ) const
+{
+	HashMap< Object*, ObjectPtr >::ConstIterator found = m_Clones.Find( source );
+	return found != m_Clones.End() ? found->Second().Ptr() : NULL;
+}
+
+size_t ObjectCloneMap::GetSize() const
+{
+	return m_Clones.GetSize();
+}
+
+void ObjectCloneMap::Clear()
+{
+	m_Clones.Clear();
+}
+
+bool ObjectCloneMap::IsSealed() const
+{
+	return m_Sealed;
+}
+
+ObjectCloneMap* ObjectCloneMap::GetCurrent()
+{
+	return static_cast< ObjectCloneMap* >( g_CurrentObjectCloneMap.GetPointer() );
+}
+
+bool Reflect::CloneThroughCurrentMap( Object* source, Object*& clone )
+{
+	ObjectCloneMap* clones = ObjectCloneMap::GetCurrent();
+	if ( !clones )
+	{
+		return false;
+	}
+
+	// a sealed map is being read by several threads, objects it doesn't have get a clone of their own
+	if ( clones->IsSealed() )
+	{
+		clone = clones->Find( source );
+		return clone || !source;
+	}
+
+	// the map holds the clone
+	clone = clones->Clone( source ).Ptr();
+	return true;
 }
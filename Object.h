@@ -8,6 +8,7 @@
 #include "Foundation/ConcurrentHashSet.h"
 #include "Foundation/Event.h"
 #include "Foundation/FilePath.h"
+#include "Foundation/HashMap.h"
 #include "Foundation/ReferenceCounting.h"
 
 #include "Reflect/API.h"
@@ -46,9 +47,17 @@ namespace Helium
 			static RefCountProxy< Object >* Allocate();
 			static void Release( RefCountProxy< Object >* pProxy );
 
+			static void ReleaseThreadCache();
 			static void Shutdown();
 			//@}
 
+			/// @name Inline Reference Count Proxy Support
+			//@{
+			static void* AllocateInline( size_t bytes );
+			static void FreeInline( void* pObjectMemory );
+			static void BindInline( Object* pObject );
+			//@}
+
 #if HELIUM_ENABLE_MEMORY_TRACKING
 			/// @name Active Proxy Iteration
 			//@{
@@ -61,7 +70,9 @@ namespace Helium
 			struct StaticTranslator;
 
 			/// Static proxy management data.
-			static StaticTranslator* sm_pStaticTranslator;
+			static StaticTranslator* volatile sm_pStaticTranslator;
+
+			static StaticTranslator* GetStaticTranslator();
 		};
 
 		//
@@ -72,15 +83,33 @@ namespace Helium
 		{
 			const Object* m_Object;
 			const Field* m_Field;
+			const FieldBitSet* m_Fields; // the fields changed, when changes were coalesced by a transaction
 
-			ObjectChangeArgs( const Object* object, const Field* field = NULL )
+			ObjectChangeArgs( const Object* object, const Field* field = NULL, const FieldBitSet* fields = NULL )
 				: m_Object( object )
 				, m_Field( field )
+				, m_Fields( fields )
 			{
 			}
 		};
 		typedef Helium::Signature< const ObjectChangeArgs&, Helium::AtomicRefCountBase > ObjectChangeSignature;
 
+		//
+		// Flags kept by each object
+		//
+
+		namespace ObjectFlags
+		{
+			enum MetaType
+			{
+				Sampled     = 1 << 0, // recorded by ObjectSampler
+				CopyOnWrite = 1 << 1, // shares the objects it references with the object it was cloned from until changed
+				DirtyFields = 1 << 2, // tracks the fields changed
+				Listened    = 1 << 3, // has change listeners (kept by ObjectChangeListeners)
+				Frozen      = 1 << 4, // refuses changes through the notification APIs, as do the objects it references
+			};
+		}
+
 		//
 		// Object is the abstract base class of a serializable class
 		//
@@ -90,9 +119,15 @@ namespace Helium
 		protected:
 			HELIUM_DECLARE_REF_COUNT( Object, ObjectRefCountSupport );
 
+			// ObjectFlags, set and cleared atomically since an object's flags can be changed from several threads
+			mutable volatile int32_t m_ObjectFlags;
+
 		protected:
 			Object();
 
+			// for the copy constructors of copyable classes, the copy starts with no references, flags or listeners
+			Object( const Object& source );
+
 		public:
 			virtual ~Object();
 
@@ -105,6 +140,9 @@ namespace Helium
 			void operator delete( void* ptr, size_t bytes );
 			void operator delete( void* ptr, void* memory );
 
+			// Is this object recorded by ObjectSampler
+			bool IsSampled() const;
+
 			virtual void RefCountPreDestroy();
 			virtual void RefCountDestroy();  // This should only be called by the reference counting system!
 			virtual void RefCountSwapProxies( Object *pOtherObject );
@@ -152,19 +190,49 @@ namespace Helium
 			// Copy this object's data into another object isntance
 			virtual void CopyTo( Object* object );
 
-			// Copy this object's data into a new instance
+			// Copy this object's data into a new instance (with the copy constructor of copyable classes)
 			virtual ObjectPtr Clone();
 
+			// Copy this object's data into a new instance, cloning each object it references only once
+			//  (references shared between objects, and cycles, are reproduced among the clones)
+			ObjectPtr CloneGraph();
+
+			// Copy this object's data into a new instance sharing the objects this one references until it's first changed,
+			//  so snapshots that are only read skip the deep copy (a change through ChangeField, FieldChanged or RaiseChanged
+			//  deep copies them first, so change the pointer fields of such a clone with ChangeField)
+			//  only a frozen object shares what it references, others are deep copied like CloneGraph (so snapshots of a
+			//  document still being edited save nothing, freeze it while taking them and thaw it once they're materialized)
+			ObjectPtr CloneOnWrite();
+
+			// Stop this object, and every object it references, from being changed through the notification APIs
+			//  fields written directly aren't stopped, and change the objects copy-on-write clones share
+			void Freeze();
+			bool IsFrozen() const;
+
+			// Let this object, and every object it references, be changed again
+			//  copy-on-write clones of it still share what it references, so Materialize them before changing it
+			void Thaw();
+
+			// Deep copy the objects still shared by a copy-on-write clone (objects shared among them stay shared)
+			void Materialize();
+
+			// Does this object still share the objects it references with the object it was cloned from
+			bool IsCopyOnWrite() const;
+
 			//
 			// Notification
 			//
 
-			// Event raised when an object is modified
-			mutable ObjectChangeSignature::Event e_Changed;
+			// Listen for modifications of this object (listeners are kept outside the object, few objects ever have any)
+			void AddChangedListener( const ObjectChangeSignature::Delegate& listener ) const;
+			void RemoveChangedListener( const ObjectChangeSignature::Delegate& listener ) const;
 
 			// Raise the modification event manually, null field mean ambiguous/multiple changes
 			virtual void RaiseChanged( const Field* field = NULL ) const;
 
+			// Warn of a change to a frozen object, which is refused
+			void RefuseChange( const Field* field ) const;
+
 			// Notify a particular field was changed
 			template< class FieldT >
 			void FieldChanged( FieldT* fieldAddress ) const;
@@ -172,6 +240,23 @@ namespace Helium
 			// Modify and notify a field change
 			template< class ObjectT, class FieldT >
 			void ChangeField( FieldT ObjectT::* field, const FieldT& newValue );
+
+			//
+			// Dirty Fields
+			//
+
+			// Start (or stop) tracking the fields changed through the notification APIs, tracking starts with none dirty
+			void TrackDirtyFields( bool track = true );
+			bool IsTrackingDirtyFields() const;
+
+			// Query the fields changed since tracking started or was last cleared (a change without a field dirties every field)
+			bool GetDirtyFields( FieldBitSet& fields ) const;
+			bool IsFieldDirty( const Field* field ) const;
+			void ClearDirtyFields();
+
+		private:
+			// Freeze or thaw this object and every object it references
+			void SetFrozen( bool freeze );
 		};
 
 		//
@@ -205,6 +290,58 @@ namespace Helium
 		inline const DerivedT* SafeCast(const Reflect::Object* base);
 
 
+		//
+		// ObjectCloneMap remembers the clone made of each object while cloning a graph
+		//  while it clones an object, the pointers copied on the calling thread clone their objects through it
+		//  use one map for several roots to clone them as a single graph
+		//
+
+		class HELIUM_REFLECT_API ObjectCloneMap : NonCopyable
+		{
+		public:
+			ObjectCloneMap();
+			~ObjectCloneMap();
+
+			// the clone of an object, made (with the objects it references) if it hasn't been cloned yet
+			ObjectPtr Clone( Object* source );
+
+			// same as Clone, but the data of the objects is copied by threadCount threads (the calling thread included)
+			//  the reachable objects are found and their clones created (through their creators) up front
+			//  PreSerialize/PreDeserialize are called in the order the objects were found (source first, breadth first),
+			//  and PostDeserialize/PostSerialize in the reverse order, all from the calling thread
+			ObjectPtr CloneParallel( Object* source, uint32_t threadCount );
+
+			// the clone made of an object, NULL if it hasn't been cloned
+			Object* Find( Object* source ) const;
+
+			// objects cloned so far
+			size_t GetSize() const;
+
+			// forget the clones (releasing the references held on them)
+			void Clear();
+
+			// the map cloning an object on the calling thread, NULL if there is none
+			static ObjectCloneMap* GetCurrent();
+
+			// is the map only read, while several threads copy through it
+			bool IsSealed() const;
+
+		private:
+			// seals a map for its lifetime
+			class SealScope : NonCopyable
+			{
+			public:
+				SealScope( ObjectCloneMap& clones );
+				~SealScope();
+
+			private:
+				ObjectCloneMap& m_Clones;
+			};
+
+			HashMap< Object*, ObjectPtr > m_Clones;
+			bool                          m_Sealed;
+		};
+
 		//
 		// Specifies an identifier for an object
 		//
@@ -11,6 +11,12 @@ void Helium::Reflect::Object::FieldChanged( FieldT* fieldAddress ) const
     //  or your field is not exposed to Reflect, add it in your MetaStruct function
     HELIUM_ASSERT( field );
 
+    // a copy-on-write clone stops sharing before anything sees the change
+    if ( m_ObjectFlags & ObjectFlags::CopyOnWrite )
+    {
+        const_cast< Object* >( this )->Materialize();
+    }
+
     // notify listeners that this field changed
     RaiseChanged( field );
 }
@@ -18,8 +24,21 @@ void Helium::Reflect::Object::FieldChanged( FieldT* fieldAddress ) const
 template< class ObjectT, class FieldT >
 void Helium::Reflect::Object::ChangeField( FieldT ObjectT::* pointerToMember, const FieldT& newValue )
 {
+    // a frozen object may be shared by copy-on-write clones, so it keeps its value
+    if ( m_ObjectFlags & ObjectFlags::Frozen )
+    {
+        RefuseChange( GetMetaClass()->FindField( pointerToMember ) );
+        return;
+    }
+
+    // a copy-on-write clone stops sharing before it's written to
+    if ( m_ObjectFlags & ObjectFlags::CopyOnWrite )
+    {
+        Materialize();
+    }
+
     // set the field via pointer-to-member on the deduced templated type (!)
-    this->*pointerToMember = newValue;
+    static_cast< ObjectT* >( this )->*pointerToMember = newValue;
 
     // find the field in our reflection information
     const Reflect::Field* field = GetMetaClass()->FindField( pointerToMember );
@@ -0,0 +1,298 @@
+#include "ReflectPch.h"
+#include "Reflect/ObjectArena.h"
+
+#include "Platform/Atomic.h"
+#include "Platform/Locks.h"
+#include "Platform/Thread.h"
+
+#include "Foundation/DynamicArray.h"
+
+#include "Reflect/Object.h"
+
+using namespace Helium;
+using namespace Helium::Reflect;
+
+// chunks are 1MB and aligned to their size, so the chunk of an object is found by masking its address
+static const uint32_t ObjectArenaChunkShift = 20;
+static const size_t   ObjectArenaChunkSize = static_cast< size_t >( 1 ) << ObjectArenaChunkShift;
+
+// objects bigger than this come from the heap rather than waste the end of a chunk
+static const size_t   ObjectArenaMaximumObject = ObjectArenaChunkSize / 8;
+
+// which chunks belong to arenas is kept in a two level map with a byte per chunk (covering 48-bit addresses)
+static const uint32_t ObjectArenaMapLeafBits = 16;
+static const uint32_t ObjectArenaMapRootBits = 48 - ObjectArenaChunkShift - ObjectArenaMapLeafBits;
+
+namespace ObjectArenaStates
+{
+	enum ObjectArenaState
+	{
+		Live,
+		Tombstone, // destroyed by a release while still referenced
+		Dead,
+	};
+}
+
+// precedes every object, its size keeps the object SIMD aligned
+struct ObjectArenaHeader
+{
+	uint32_t         m_Size;  // bytes up to the next header
+	volatile int32_t m_State;
+	uint32_t         m_Padding[ 2 ];
+};
+
+struct Helium::Reflect::ObjectArenaChunk
+{
+	ObjectArenaChunk* m_Next;
+	ObjectArena*      m_Arena;       // NULL once released with tombstones still referenced
+	size_t            m_Used;        // bytes handed out, this header included
+	volatile int32_t  m_Tombstones;  // tombstones left by the release, the chunk is freed when the last one is
+	uint32_t          m_Padding;
+};
+
+// stands in for an object destroyed by a release while references to it are still being dropped
+class ObjectArenaTombstone : public Object
+{
+public:
+	virtual void RefCountDestroy() HELIUM_OVERRIDE
+	{
+		void* memory = this;
+		this->~ObjectArenaTombstone();
+		ObjectArena::Free( memory );
+	}
+};
+
+static uint8_t* volatile  g_ObjectArenaMap[ static_cast< size_t >( 1 ) << ObjectArenaMapRootBits ];
+static Mutex              g_ObjectArenaMapLock;
+static ThreadLocalPointer g_CurrentObjectArena;
+
+static bool GetObjectArenaMapIndex( const void* memory, size_t& root, size_t& leaf )
+{
+	uint64_t chunk = static_cast< uint64_t >( reinterpret_cast< uintptr_t >( memory ) ) >> ObjectArenaChunkShift;
+	root = static_cast< size_t >( chunk >> ObjectArenaMapLeafBits );
+	leaf = static_cast< size_t >( chunk & ( ( static_cast< uint64_t >( 1 ) << ObjectArenaMapLeafBits ) - 1 ) );
+	return root < HELIUM_ARRAY_COUNT( g_ObjectArenaMap );
+}
+
+static bool MapObjectArenaChunk( ObjectArenaChunk* chunk, bool mapped )
+{
+	size_t root, leaf;
+	if ( !GetObjectArenaMapIndex( chunk, root, leaf ) )
+	{
+		return false;
+	}
+
+	MutexScopeLock lock ( g_ObjectArenaMapLock );
+
+	uint8_t* leaves = g_ObjectArenaMap[ root ];
+	if ( !leaves )
+	{
+		// leaves are never freed, so readers need no lock
+		leaves = new uint8_t[ static_cast< size_t >( 1 ) << ObjectArenaMapLeafBits ];
+		MemoryZero( leaves, static_cast< size_t >( 1 ) << ObjectArenaMapLeafBits );
+		AtomicExchangeRelease( g_ObjectArenaMap[ root ], leaves );
+	}
+
+	leaves[ leaf ] = mapped ? 1 : 0;
+	return true;
+}
+
+static void FreeObjectArenaChunk( ObjectArenaChunk* chunk )
+{
+	MapObjectArenaChunk( chunk, false );
+
+	DefaultAllocator allocator;
+	allocator.FreeAligned( chunk );
+}
+
+static ObjectArenaChunk* GetObjectArenaChunk( const void* memory )
+{
+	return reinterpret_cast< ObjectArenaChunk* >( reinterpret_cast< uintptr_t >( memory ) & ~( static_cast< uintptr_t >( ObjectArenaChunkSize ) - 1 ) );
+}
+
+ObjectArena::ObjectArena()
+	: m_Chunks( NULL )
+	, m_LiveCount( 0 )
+	, m_ChunkCount( 0 )
+	, m_ScopeCount( 0 )
+{
+}
+
+ObjectArena::~ObjectArena()
+{
+	Release();
+}
+
+void ObjectArena::Release()
+{
+	HELIUM_ASSERT( m_ScopeCount == 0 );
+
+	// oldest chunk first, so objects are destroyed in the order they were created
+	//  (objects usually create what they reference, so most references are dropped before their target is reached)
+	DynamicArray< ObjectArenaChunk* > chunks;
+	chunks.Reserve( m_ChunkCount );
+	for ( ObjectArenaChunk* chunk = m_Chunks; chunk; chunk = chunk->m_Next )
+	{
+		chunks.Add( chunk );
+	}
+
+	for ( size_t i=chunks.GetSize(); i>0; --i )
+	{
+		ObjectArenaChunk* chunk = chunks[ i - 1 ];
+		for ( size_t offset = sizeof( ObjectArenaChunk ); offset < chunk->m_Used; )
+		{
+			ObjectArenaHeader* header = reinterpret_cast< ObjectArenaHeader* >( reinterpret_cast< char* >( chunk ) + offset );
+			offset += header->m_Size;
+
+			// objects destroyed by the ones before them (or before the release) are already gone
+			if ( header->m_State != ObjectArenaStates::Live )
+			{
+				continue;
+			}
+
+			// hold the object while it's destroyed, so a cycle dropping its last reference can't destroy it again,
+			//  then leave a tombstone to take the references still to be dropped (later in the sweep or from outside)
+			Object* object = reinterpret_cast< Object* >( header + 1 );
+			ObjectPtr hold ( object );
+
+			object->RefCountPreDestroy();
+			object->~Object();
+
+			new ( static_cast< void* >( object ) ) ObjectArenaTombstone;
+			header->m_State = ObjectArenaStates::Tombstone;
+		}
+	}
+
+	// tombstones left are referenced from outside the arena, so keep their chunks rather than leave dangling references
+	//  until the last tombstone of each is freed
+	HELIUM_ASSERT_MSG( m_LiveCount == 0, TXT( "%d objects of a released arena are still referenced from outside it" ), m_LiveCount );
+	for ( size_t i=0; i<chunks.GetSize(); ++i )
+	{
+		ObjectArenaChunk* chunk = chunks[ i ];
+
+		int32_t tombstones = 0;
+		for ( size_t offset = sizeof( ObjectArenaChunk ); offset < chunk->m_Used; )
+		{
+			ObjectArenaHeader* header = reinterpret_cast< ObjectArenaHeader* >( reinterpret_cast< char* >( chunk ) + offset );
+			if ( header->m_State != ObjectArenaStates::Dead )
+			{
+				++tombstones;
+			}
+			offset += header->m_Size;
+		}
+
+		if ( tombstones )
+		{
+			chunk->m_Tombstones = tombstones;
+			chunk->m_Arena = NULL;
+		}
+		else
+		{
+			FreeObjectArenaChunk( chunk );
+		}
+	}
+
+	m_Chunks = NULL;
+	m_ChunkCount = 0;
+	m_LiveCount = 0;
+}
+
+int32_t ObjectArena::GetLiveCount() const
+{
+	return m_LiveCount;
+}
+
+size_t ObjectArena::GetReservedBytes() const
+{
+	return m_ChunkCount * ObjectArenaChunkSize;
+}
+
+void* ObjectArena::Allocate( size_t bytes )
+{
+	size_t size = sizeof( ObjectArenaHeader ) + ( ( bytes + HELIUM_SIMD_ALIGNMENT - 1 ) & ~static_cast< size_t >( HELIUM_SIMD_ALIGNMENT - 1 ) );
+	if ( size > ObjectArenaMaximumObject )
+	{
+		return NULL;
+	}
+
+	ObjectArenaChunk* chunk = m_Chunks;
+	if ( !chunk || chunk->m_Used + size > ObjectArenaChunkSize )
+	{
+		DefaultAllocator allocator;
+		chunk = static_cast< ObjectArenaChunk* >( allocator.AllocateAligned( ObjectArenaChunkSize, ObjectArenaChunkSize ) );
+		if ( !MapObjectArenaChunk( chunk, true ) )
+		{
+			HELIUM_ASSERT( false );
+			allocator.FreeAligned( chunk );
+			return NULL;
+		}
+
+		chunk->m_Next = m_Chunks;
+		chunk->m_Arena = this;
+		chunk->m_Used = sizeof( ObjectArenaChunk );
+		chunk->m_Tombstones = 0;
+		m_Chunks = chunk;
+		++m_ChunkCount;
+	}
+
+	ObjectArenaHeader* header = reinterpret_cast< ObjectArenaHeader* >( reinterpret_cast< char* >( chunk ) + chunk->m_Used );
+	header->m_Size = static_cast< uint32_t >( size );
+	header->m_State = ObjectArenaStates::Live;
+	chunk->m_Used += size;
+
+	AtomicIncrementUnsafe( m_LiveCount );
+	return header + 1;
+}
+
+ObjectArena* ObjectArena::GetCurrent()
+{
+	return static_cast< ObjectArena* >( g_CurrentObjectArena.GetPointer() );
+}
+
+bool ObjectArena::Contains( const void* memory )
+{
+	size_t root, leaf;
+	if ( !memory || !GetObjectArenaMapIndex( memory, root, leaf ) )
+	{
+		return false;
+	}
+
+	const uint8_t* leaves = g_ObjectArenaMap[ root ];
+	return leaves && leaves[ leaf ];
+}
+
+void ObjectArena::Free( void* memory )
+{
+	HELIUM_ASSERT( Contains( memory ) );
+
+	ObjectArenaHeader* header = static_cast< ObjectArenaHeader* >( memory ) - 1;
+	HELIUM_ASSERT( header->m_State != ObjectArenaStates::Dead );
+	header->m_State = ObjectArenaStates::Dead;
+
+	ObjectArenaChunk* chunk = GetObjectArenaChunk( memory );
+	ObjectArena* arena = chunk->m_Arena;
+	if ( arena )
+	{
+		AtomicDecrementUnsafe( arena->m_LiveCount );
+	}
+	else if ( AtomicDecrementRelease( chunk->m_Tombstones ) == 0 )
+	{
+		// the last tombstone of a released arena's chunk
+		FreeObjectArenaChunk( chunk );
+	}
+}
+
+ObjectArenaScope::ObjectArenaScope( ObjectArena& arena )
+	: m_Arena( &arena )
+	, m_Previous( ObjectArena::GetCurrent() )
+{
+	++m_Arena->m_ScopeCount;
+	g_CurrentObjectArena.SetPointer( m_Arena );
+}
+
+ObjectArenaScope::~ObjectArenaScope()
+{
+	HELIUM_ASSERT( ObjectArena::GetCurrent() == m_Arena );
+	g_CurrentObjectArena.SetPointer( m_Previous );
+	--m_Arena->m_ScopeCount;
+}
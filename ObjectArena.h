@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Platform/Types.h"
+#include "Platform/Utility.h"
+
+#include "Reflect/API.h"
+
+namespace Helium
+{
+	namespace Reflect
+	{
+		struct ObjectArenaChunk;
+
+		//
+		// ObjectArena places the objects created inside an ObjectArenaScope contiguously in large chunks
+		//  objects are still reference counted, one that dies early is destructed but its memory stays in the arena
+		//  Release destructs every object still alive (oldest first, cycles included) and returns all the chunks at once
+		//  objects still referenced from outside the arena when it's released assert, their chunks are freed once the references are dropped
+		//  an arena is filled by one thread at a time, and nothing may use its objects while it is being released
+		//
+
+		class HELIUM_REFLECT_API ObjectArena : NonCopyable
+		{
+		public:
+			ObjectArena();
+			~ObjectArena();
+
+			// destroy the objects still alive and free the chunks, the arena can be filled again afterward
+			void Release();
+
+			// objects allocated in the arena that haven't been destroyed
+			int32_t GetLiveCount() const;
+
+			// bytes of chunk memory held by the arena
+			size_t GetReservedBytes() const;
+
+			// memory for an object, NULL if it's too big to place in a chunk (it should come from the heap instead)
+			void* Allocate( size_t bytes );
+
+			// the arena of the innermost scope on the calling thread, NULL if there is none
+			static ObjectArena* GetCurrent();
+
+			// is the memory of an object inside an arena chunk
+			static bool Contains( const void* memory );
+
+			// note the object in memory (inside an arena chunk) is gone, its memory is reclaimed when the arena is released
+			static void Free( void* memory );
+
+		private:
+			friend class ObjectArenaScope;
+
+			ObjectArenaChunk* m_Chunks;    // most recent first
+			volatile int32_t  m_LiveCount;
+			uint32_t          m_ChunkCount;
+			uint32_t          m_ScopeCount; // scopes currently open on the arena
+		};
+
+		//
+		// ObjectArenaScope sends the objects created by the calling thread to an arena for its lifetime
+		//
+
+		class HELIUM_REFLECT_API ObjectArenaScope : NonCopyable
+		{
+		public:
+			ObjectArenaScope( ObjectArena& arena );
+			~ObjectArenaScope();
+
+		private:
+			ObjectArena* m_Arena;
+			ObjectArena* m_Previous;
+		};
+	}
+}
@@ -0,0 +1,197 @@
+#include "ReflectPch.h"
+#include "Reflect/ObjectChanges.h"
+
+#include "Platform/Locks.h"
+#include "Platform/Thread.h"
+
+using namespace Helium;
+using namespace Helium::Reflect;
+
+static ThreadLocalPointer g_CurrentObjectChangeTransaction;
+
+// the listeners of each object that has had any, an object's event lives as long as it does
+//  (so listeners can be removed while it's raised)
+static HashMap< const Object*, ObjectChangeSignature::Event* > g_ObjectChangeListeners;
+static Mutex                                                   g_ObjectChangeListenersLock;
+
+ObjectChangeTransaction::ObjectChangeTransaction()
+	: m_Outer( GetCurrent() )
+	, m_Last( NULL )
+	, m_LastIndex( 0 )
+{
+	if ( !m_Outer )
+	{
+		g_CurrentObjectChangeTransaction.SetPointer( this );
+	}
+}
+
+ObjectChangeTransaction::~ObjectChangeTransaction()
+{
+	if ( m_Outer )
+	{
+		return;
+	}
+
+	HELIUM_ASSERT( GetCurrent() == this );
+	g_CurrentObjectChangeTransaction.SetPointer( NULL );
+
+	// listeners are free to change objects again, those changes are raised right away
+	for ( size_t i=0; i<m_Changes.GetSize(); ++i )
+	{
+		const Change& change = m_Changes[ i ];
+		if ( !change.m_Proxy )
+		{
+			continue;
+		}
+
+		// objects destroyed since they changed are skipped, the others are held while their listeners run
+		if ( change.m_Proxy->GetStrongRefCount() )
+		{
+			ObjectPtr object = const_cast< Object* >( change.m_Object );
+			if ( change.m_Ambiguous )
+			{
+				ObjectChangeListeners::Raise( ObjectChangeArgs( change.m_Object ) );
+			}
+			else
+			{
+				ObjectChangeListeners::Raise( ObjectChangeArgs( change.m_Object, change.m_Field, &change.m_Fields ) );
+			}
+		}
+
+		change.m_Proxy->RemoveWeakRef();
+	}
+}
+
+size_t ObjectChangeTransaction::GetSize() const
+{
+	return m_Outer ? m_Outer->GetSize() : m_Changes.GetSize();
+}
+
+ObjectChangeTransaction* ObjectChangeTransaction::GetCurrent()
+{
+	return static_cast< ObjectChangeTransaction* >( g_CurrentObjectChangeTransaction.GetPointer() );
+}
+
+void ObjectChangeTransaction::Record( const Object* object, const Field* field )
+{
+	HELIUM_ASSERT( !m_Outer );
+
+	// an object no one references is still being constructed or is being destroyed, holding it back would
+	//  either free it when the transaction ends or bring it back from the dead, so its change is raised now
+	RefCountProxy< Object >* proxy = object->GetRefCountProxy();
+	if ( !proxy->GetStrongRefCount() )
+	{
+		ObjectChangeListeners::Raise( ObjectChangeArgs( object, field ) );
+		return;
+	}
+
+	// bulk edits usually change one object many times in a row
+	if ( object != m_Last || m_Changes[ m_LastIndex ].m_Proxy != proxy )
+	{
+		HashMap< const Object*, size_t >::Iterator found = m_Indices.Find( object );
+		if ( found != m_Indices.End() && m_Changes[ found->Second() ].m_Proxy != proxy )
+		{
+			// the object changed before was destroyed, and this one took its memory
+			Change& stale = m_Changes[ found->Second() ];
+			stale.m_Proxy->RemoveWeakRef();
+			stale.m_Proxy = NULL;
+			m_Indices.Remove( found );
+			found = m_Indices.End();
+		}
+
+		if ( found == m_Indices.End() )
+		{
+			proxy->AddWeakRef();
+
+			Change change;
+			change.m_Object = object;
+			change.m_Proxy = proxy;
+			change.m_Field = field;
+			change.m_Ambiguous = false;
+			found = m_Indices.Insert( HashMap< const Object*, size_t >::ValueType( object, m_Changes.Add( change ) ) ).First();
+		}
+
+		m_Last = object;
+		m_LastIndex = found->Second();
+	}
+
+	Change& change = m_Changes[ m_LastIndex ];
+	if ( !field )
+	{
+		change.m_Ambiguous = true;
+	}
+	else
+	{
+		if ( change.m_Field != field )
+		{
+			change.m_Field = NULL;
+		}
+
+		change.m_Fields.Set( field->m_Index );
+	}
+}
+
+void ObjectChangeListeners::Add( const Object* object, const ObjectChangeSignature::Delegate& listener )
+{
+	MutexScopeLock lock ( g_ObjectChangeListenersLock );
+
+	HashMap< const Object*, ObjectChangeSignature::Event* >::Iterator found = g_ObjectChangeListeners.Find( object );
+	if ( found == g_ObjectChangeListeners.End() )
+	{
+		found = g_ObjectChangeListeners.Insert( HashMap< const Object*, ObjectChangeSignature::Event* >::ValueType( object, new ObjectChangeSignature::Event ) ).First();
+	}
+
+	found->Second()->Add( listener );
+}
+
+void ObjectChangeListeners::Remove( const Object* object, const ObjectChangeSignature::Delegate& listener )
+{
+	MutexScopeLock lock ( g_ObjectChangeListenersLock );
+
+	HashMap< const Object*, ObjectChangeSignature::Event* >::Iterator found = g_ObjectChangeListeners.Find( object );
+	if ( found != g_ObjectChangeListeners.End() )
+	{
+		found->Second()->Remove( listener );
+	}
+}
+
+void ObjectChangeListeners::Raise( const ObjectChangeArgs& args )
+{
+	ObjectChangeSignature::Event* event = NULL;
+	{
+		MutexScopeLock lock ( g_ObjectChangeListenersLock );
+
+		HashMap< const Object*, ObjectChangeSignature::Event* >::Iterator found = g_ObjectChangeListeners.Find( args.m_Object );
+		if ( found != g_ObjectChangeListeners.End() )
+		{
+			event = found->Second();
+		}
+	}
+
+	// raised without the lock, listeners may add and remove listeners
+	if ( event )
+	{
+		event->Raise( args );
+	}
+}
+
+void ObjectChangeListeners::Destruct( const Object* object )
+{
+	ObjectChangeSignature::Event* event = NULL;
+	{
+		MutexScopeLock lock ( g_ObjectChangeListenersLock );
+
+		HashMap< const Object*, ObjectChangeSignature::Event* >::Iterator found = g_ObjectChangeListeners.Find( object );
+		HELIUM_ASSERT( found != g_ObjectChangeListeners.End() );
+		event = found->Second();
+		g_ObjectChangeListeners.Remove( found );
+	}
+
+	delete event;
+}
+
+size_t ObjectChangeListeners::GetCount()
+{
+	MutexScopeLock lock ( g_ObjectChangeListenersLock );
+	return g_ObjectChangeListeners.GetSize();
+}
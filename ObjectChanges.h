@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Platform/Types.h"
+#include "Platform/Utility.h"
+
+#include "Foundation/DynamicArray.h"
+#include "Foundation/HashMap.h"
+
+#include "Reflect/API.h"
+#include "Reflect/Object.h"
+
+namespace Helium
+{
+	namespace Reflect
+	{
+		//
+		// ObjectChangeListeners keeps the change listeners of objects outside of them, since few objects ever have any
+		//  objects flag that they have listeners, so raising a change on the others skips the lookup
+		//
+
+		class HELIUM_REFLECT_API ObjectChangeListeners
+		{
+		public:
+			// called by Object to add and remove its listeners
+			static void Add( const Object* object, const ObjectChangeSignature::Delegate& listener );
+			static void Remove( const Object* object, const ObjectChangeSignature::Delegate& listener );
+
+			// called by Object to notify the listeners of an object
+			static void Raise( const ObjectChangeArgs& args );
+
+			// called by Object for objects with listeners
+			static void Destruct( const Object* object );
+
+			// objects with listeners
+			static size_t GetCount();
+		};
+
+		//
+		// ObjectChangeTransaction holds back the change notifications raised by the calling thread for its lifetime,
+		//  then raises one per object changed (in the order they first changed) listing every field changed
+		//  an object changed in a way no field describes gets one notification without a field, like it would otherwise
+		//  objects changed are only weakly referenced, those destroyed before the transaction ends get no notification,
+		//  and objects no one references (still being constructed, or being destroyed) raise theirs right away
+		//  nested transactions join the outermost one
+		//
+
+		class HELIUM_REFLECT_API ObjectChangeTransaction : NonCopyable
+		{
+		public:
+			ObjectChangeTransaction();
+			~ObjectChangeTransaction();
+
+			// objects changed so far
+			size_t GetSize() const;
+
+			// the transaction collecting the calling thread's changes, NULL if there is none
+			static ObjectChangeTransaction* GetCurrent();
+
+			// called by Object to hold back a change notification
+			void Record( const Object* object, const Field* field );
+
+		private:
+			struct Change
+			{
+				const Object*              m_Object;
+				RefCountProxy< Object >*   m_Proxy;     // weakly referenced, NULL once the object's change is dropped
+				const Field*               m_Field;     // the only field changed, NULL if there were several
+				FieldBitSet                m_Fields;
+				bool                       m_Ambiguous; // changed without a field
+			};
+
+			ObjectChangeTransaction*         m_Outer;     // the outermost transaction, if this one is nested
+			DynamicArray< Change >           m_Changes;
+			HashMap< const Object*, size_t > m_Indices;   // of each object's change
+			const Object*                    m_Last;      // the object changed last
+			size_t                           m_LastIndex; // of its change
+		};
+	}
+}
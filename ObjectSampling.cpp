@@ -0,0 +1,172 @@
+#include "ReflectPch.h"
+#include "Reflect/ObjectSampling.h"
+
+#include "Platform/Locks.h"
+#include "Platform/Thread.h"
+
+#include "Foundation/HashMap.h"
+#include "Foundation/Log.h"
+
+#include "Reflect/MetaClass.h"
+#include "Reflect/Object.h"
+
+#include <algorithm>
+
+using namespace Helium;
+using namespace Helium::Reflect;
+
+volatile uint32_t ObjectSampler::s_Interval = 0;
+
+// a sampled object, the interval it was sampled at and the class it's filed under (NULL until it's known)
+struct ObjectSample
+{
+	uint32_t         m_Interval;
+	const MetaClass* m_Class;
+};
+
+// sampled objects, and the live counts of the classes they're filed under
+static HashMap< Object*, ObjectSample >                   g_ObjectSamples;
+static HashMap< const MetaClass*, ObjectSampleCount >     g_ObjectSampleCounts;
+static Mutex                                              g_ObjectSamplesLock;
+
+// objects the calling thread still has to create before its next sample, zero if it hasn't drawn one yet
+//  (kept in the pointer itself, so threads have nothing to free)
+static ThreadLocalPointer           g_ObjectSampleCountdown;
+
+static bool SortObjectSampleCounts( const ObjectSampleCount& lhs, const ObjectSampleCount& rhs )
+{
+	return lhs.m_Estimate > rhs.m_Estimate;
+}
+
+void ObjectSampler::SetInterval( uint32_t interval )
+{
+	s_Interval = interval;
+}
+
+// count a sample toward a class, with the samples lock held
+static void AddObjectSample( const ObjectSample& sample )
+{
+	HashMap< const MetaClass*, ObjectSampleCount >::Iterator found = g_ObjectSampleCounts.Find( sample.m_Class );
+	if ( found == g_ObjectSampleCounts.End() )
+	{
+		ObjectSampleCount count = { sample.m_Class, 0, 0 };
+		found = g_ObjectSampleCounts.Insert( HashMap< const MetaClass*, ObjectSampleCount >::ValueType( sample.m_Class, count ) ).First();
+	}
+
+	++found->Second().m_Samples;
+	found->Second().m_Estimate += sample.m_Interval;
+}
+
+// take a sample off the count of its class, with the samples lock held
+static void RemoveObjectSample( const ObjectSample& sample )
+{
+	HashMap< const MetaClass*, ObjectSampleCount >::Iterator found = g_ObjectSampleCounts.Find( sample.m_Class );
+	HELIUM_ASSERT( found != g_ObjectSampleCounts.End() );
+
+	if ( --found->Second().m_Samples )
+	{
+		found->Second().m_Estimate -= sample.m_Interval;
+	}
+	else
+	{
+		g_ObjectSampleCounts.Remove( found );
+	}
+}
+
+void ObjectSampler::GetLiveCounts( DynamicArray< ObjectSampleCount >& counts )
+{
+	counts.Clear();
+
+	{
+		MutexScopeLock lock ( g_ObjectSamplesLock );
+
+		counts.Reserve( g_ObjectSampleCounts.GetSize() );
+		for ( HashMap< const MetaClass*, ObjectSampleCount >::ConstIterator itr = g_ObjectSampleCounts.Begin(), end = g_ObjectSampleCounts.End(); itr != end; ++itr )
+		{
+			counts.Add( itr->Second() );
+		}
+	}
+
+	std::sort( counts.GetData(), counts.GetData() + counts.GetSize(), &SortObjectSampleCounts );
+}
+
+void ObjectSampler::Report()
+{
+	DynamicArray< ObjectSampleCount > counts;
+	GetLiveCounts( counts );
+
+	for ( size_t i=0; i<counts.GetSize(); ++i )
+	{
+		const ObjectSampleCount& count = counts[ i ];
+		Log::Print( TXT( "Live objects %s: about %llu (%d sampled)\n" ),
+			count.m_Class ? count.m_Class->m_Name : TXT( "<unknown>" ), (unsigned long long)count.m_Estimate, (int)count.m_Samples );
+	}
+}
+
+bool ObjectSampler::Construct( Object* object )
+{
+	uintptr_t countdown = reinterpret_cast< uintptr_t >( g_ObjectSampleCountdown.GetPointer() );
+	if ( countdown > 1 )
+	{
+		g_ObjectSampleCountdown.SetPointer( reinterpret_cast< void* >( countdown - 1 ) );
+		return false;
+	}
+
+	uint32_t interval = s_Interval;
+	if ( !interval )
+	{
+		g_ObjectSampleCountdown.SetPointer( NULL );
+		return false;
+	}
+
+	// the next countdown is between half and one and a half intervals, scrambled from the object address
+	uint64_t scramble = static_cast< uint64_t >( reinterpret_cast< uintptr_t >( object ) ) * 0x9E3779B97F4A7C15ULL;
+	uintptr_t next = interval / 2 + static_cast< uintptr_t >( ( scramble >> 32 ) % interval ) + 1;
+	g_ObjectSampleCountdown.SetPointer( reinterpret_cast< void* >( next ) );
+
+	// a thread's first countdown is only drawn
+	if ( countdown == 0 )
+	{
+		return false;
+	}
+
+	ObjectSample sample = { interval, NULL };
+
+	MutexScopeLock lock ( g_ObjectSamplesLock );
+	g_ObjectSamples.Insert( HashMap< Object*, ObjectSample >::ValueType( object, sample ) );
+	AddObjectSample( sample );
+	return true;
+}
+
+Object* ObjectSampler::Constructed( Object* object, const MetaClass* metaClass )
+{
+	// the flag was set by this thread, in the object's constructor
+	if ( object->IsSampled() && metaClass )
+	{
+		MutexScopeLock lock ( g_ObjectSamplesLock );
+
+		HashMap< Object*, ObjectSample >::Iterator found = g_ObjectSamples.Find( object );
+		HELIUM_ASSERT( found != g_ObjectSamples.End() );
+
+		ObjectSample& sample = found->Second();
+		if ( !sample.m_Class )
+		{
+			RemoveObjectSample( sample );
+			sample.m_Class = metaClass;
+			AddObjectSample( sample );
+		}
+	}
+
+	return object;
+}
+
+void ObjectSampler::Destruct( Object* object )
+{
+	MutexScopeLock lock ( g_ObjectSamplesLock );
+
+	HashMap< Object*, ObjectSample >::Iterator found = g_ObjectSamples.Find( object );
+	HELIUM_ASSERT( found != g_ObjectSamples.End() );
+
+	RemoveObjectSample( found->Second() );
+	g_ObjectSamples.Remove( found );
+}
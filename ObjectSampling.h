@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Platform/Types.h"
+
+#include "Foundation/DynamicArray.h"
+
+#include "Reflect/API.h"
+
+namespace Helium
+{
+	namespace Reflect
+	{
+		class MetaClass;
+		class Object;
+
+		//
+		// The estimated number of objects of a class alive, from the sampled ones
+		//
+
+		struct ObjectSampleCount
+		{
+			const MetaClass* m_Class;
+			uint32_t         m_Samples;   // sampled objects of the class alive
+			uint64_t         m_Estimate;  // each sample weighted by the interval it was taken at
+		};
+
+		//
+		// ObjectSampler records about one in every interval objects created, cheap enough to leave on in shipping builds
+		//  each thread counts down to its next sample (jittered so periodic creation patterns don't alias)
+		//  sampled objects carry a flag, so only their destruction takes the lock
+		//  the class of a sample isn't known yet when Object's constructor runs, so samples are filed under their class by
+		//  the creators and copiers of classes once they're constructed, and live counts are kept per class as objects come
+		//  and go (objects made with new directly stay filed under no class, since nothing tells the sampler when their
+		//  construction is done, and looking the class up on an object another thread may be constructing isn't safe)
+		//
+
+		class HELIUM_REFLECT_API ObjectSampler
+		{
+		public:
+			// sample about one in every interval objects created, zero stops sampling (objects already sampled stay tracked)
+			//  a thread picks the new interval up after its next sample
+			static void SetInterval( uint32_t interval );
+			static uint32_t GetInterval() { return s_Interval; }
+
+			// the estimated objects alive per class, most numerous first (objects made with new directly have no class)
+			static void GetLiveCounts( DynamicArray< ObjectSampleCount >& counts );
+
+			// log the estimated objects alive per class
+			static void Report();
+
+			// called by Object, true if the object under construction is sampled
+			static bool Construct( Object* object );
+
+			// called by the creators and copiers of classes once the object is constructed, returns the object
+			static Object* Constructed( Object* object, const MetaClass* metaClass );
+
+			// called by Object for sampled objects
+			static void Destruct( Object* object );
+
+		private:
+			static volatile uint32_t s_Interval;
+		};
+	}
+}
@@ -0,0 +1,271 @@
+#include "ReflectPch.h"
+#include "Reflect/ObjectSlab.h"
+
+#include "Platform/Atomic.h"
+#include "Platform/Locks.h"
+#include "Platform/Thread.h"
+
+#include "Foundation/Log.h"
+
+using namespace Helium;
+using namespace Helium::Reflect;
+
+// slots are sized in multiples of 8 bytes up to 512 bytes, bigger (or more aligned) classes use the heap
+static const uint32_t ObjectSlabGranularity = 8;
+static const uint32_t ObjectSlabSizeClasses = 64;
+static const size_t   ObjectSlabChunkSize = 16 * 1024;
+
+// slots a thread moves between its cache and the shared size class at a time
+static const uint32_t ObjectSlabBatchSize = 32;
+static const uint32_t ObjectSlabMaximumCached = ObjectSlabBatchSize * 2;
+
+struct ObjectSlabSlot
+{
+	ObjectSlabSlot* m_Next;
+};
+
+// the free slots of a size class shared by every thread
+struct ObjectSlabClass
+{
+	Mutex           m_Lock;
+	ObjectSlabSlot* m_Free;
+	uint32_t        m_Chunks;
+};
+
+// the free slots of each size class cached by a thread
+struct ObjectSlabCache
+{
+	ObjectSlabSlot* m_Free[ ObjectSlabSizeClasses ];
+	uint32_t        m_Count[ ObjectSlabSizeClasses ];
+};
+
+static ObjectSlabClass* volatile g_ObjectSlabClasses = NULL;
+static ObjectSlab* volatile      g_FirstObjectSlab = NULL;
+
+// the size classes are created on first use, threads racing to create them each build a set but only the first published is kept
+static ObjectSlabClass* GetObjectSlabClasses()
+{
+	ObjectSlabClass* classes = g_ObjectSlabClasses;
+	if ( !classes )
+	{
+		ObjectSlabClass* newClasses = new ObjectSlabClass[ ObjectSlabSizeClasses ];
+		for ( uint32_t i=0; i<ObjectSlabSizeClasses; ++i )
+		{
+			newClasses[ i ].m_Free = NULL;
+			newClasses[ i ].m_Chunks = 0;
+		}
+
+		classes = AtomicCompareExchangeRelease( g_ObjectSlabClasses, newClasses, static_cast< ObjectSlabClass* >( NULL ) );
+		if ( classes )
+		{
+			delete[] newClasses;
+		}
+		else
+		{
+			classes = newClasses;
+		}
+	}
+	return classes;
+}
+
+// move up to count slots from a thread cache back to the shared size class
+static void ReturnSlots( ObjectSlabCache* cache, uint32_t sizeClass, uint32_t count )
+{
+	ObjectSlabClass& slabClass = GetObjectSlabClasses()[ sizeClass ];
+	MutexScopeLock lock ( slabClass.m_Lock );
+
+	for ( ; count && cache->m_Free[ sizeClass ]; --count )
+	{
+		ObjectSlabSlot* slot = cache->m_Free[ sizeClass ];
+		cache->m_Free[ sizeClass ] = slot->m_Next;
+		--cache->m_Count[ sizeClass ];
+
+		slot->m_Next = slabClass.m_Free;
+		slabClass.m_Free = slot;
+	}
+}
+
+// give back every slot a thread cached
+static void ReleaseObjectSlabCache( void* pointer )
+{
+	ObjectSlabCache* cache = static_cast< ObjectSlabCache* >( pointer );
+	for ( uint32_t sizeClass=0; sizeClass<ObjectSlabSizeClasses; ++sizeClass )
+	{
+		if ( cache->m_Free[ sizeClass ] )
+		{
+			ReturnSlots( cache, sizeClass, cache->m_Count[ sizeClass ] );
+		}
+	}
+
+	delete cache;
+}
+
+// the cache of each thread, given back when the thread exits (or calls ObjectSlab::ReleaseThreadCache)
+static ThreadLocalPointer g_ObjectSlabCache ( &ReleaseObjectSlabCache );
+
+static ObjectSlabCache* GetObjectSlabCache()
+{
+	ObjectSlabCache* cache = static_cast< ObjectSlabCache* >( g_ObjectSlabCache.GetPointer() );
+	if ( !cache )
+	{
+		cache = new ObjectSlabCache;
+		MemoryZero( cache, sizeof( ObjectSlabCache ) );
+		g_ObjectSlabCache.SetPointer( cache );
+	}
+	return cache;
+}
+
+// move a batch of slots from the shared size class to a thread cache, carving a new chunk if it has none
+static void RefillSlots( ObjectSlabCache* cache, uint32_t sizeClass )
+{
+	ObjectSlabClass& slabClass = GetObjectSlabClasses()[ sizeClass ];
+	MutexScopeLock lock ( slabClass.m_Lock );
+
+	if ( !slabClass.m_Free )
+	{
+		size_t slotSize = ( sizeClass + 1 ) * ObjectSlabGranularity;
+		size_t slotCount = ObjectSlabChunkSize / slotSize;
+
+		DefaultAllocator allocator;
+		char* chunk = static_cast< char* >( allocator.AllocateAligned( HELIUM_SIMD_ALIGNMENT, ObjectSlabChunkSize ) );
+		++slabClass.m_Chunks;
+
+		// link back to front so slots are handed out in address order
+		for ( size_t i=slotCount; i>0; --i )
+		{
+			ObjectSlabSlot* slot = reinterpret_cast< ObjectSlabSlot* >( chunk + ( i - 1 ) * slotSize );
+			slot->m_Next = slabClass.m_Free;
+			slabClass.m_Free = slot;
+		}
+	}
+
+	for ( uint32_t i=0; i<ObjectSlabBatchSize && slabClass.m_Free; ++i )
+	{
+		ObjectSlabSlot* slot = slabClass.m_Free;
+		slabClass.m_Free = slot->m_Next;
+
+		slot->m_Next = cache->m_Free[ sizeClass ];
+		cache->m_Free[ sizeClass ] = slot;
+		++cache->m_Count[ sizeClass ];
+	}
+}
+
+void* ObjectSlab::Allocate()
+{
+	AtomicIncrementUnsafe( m_Allocations );
+
+	if ( !m_Listed && AtomicExchangeAcquire( m_Listed, 1 ) == 0 )
+	{
+		ObjectSlab* first;
+		do
+		{
+			first = g_FirstObjectSlab;
+			m_Next = first;
+		}
+		while ( AtomicCompareExchangeRelease( g_FirstObjectSlab, this, first ) != first );
+	}
+
+	uint32_t slotSize = GetSlotSize();
+	if ( !slotSize )
+	{
+		DefaultAllocator allocator;
+		return allocator.AllocateAligned( m_Alignment, m_Size );
+	}
+
+	uint32_t sizeClass = slotSize / ObjectSlabGranularity - 1;
+	ObjectSlabCache* cache = GetObjectSlabCache();
+	if ( !cache->m_Free[ sizeClass ] )
+	{
+		RefillSlots( cache, sizeClass );
+	}
+
+	ObjectSlabSlot* slot = cache->m_Free[ sizeClass ];
+	cache->m_Free[ sizeClass ] = slot->m_Next;
+	--cache->m_Count[ sizeClass ];
+	return slot;
+}
+
+void ObjectSlab::Free( void* memory )
+{
+	if ( !memory )
+	{
+		return;
+	}
+
+	AtomicIncrementUnsafe( m_Frees );
+
+	uint32_t slotSize = GetSlotSize();
+	if ( !slotSize )
+	{
+		DefaultAllocator allocator;
+		allocator.FreeAligned( memory );
+		return;
+	}
+
+	uint32_t sizeClass = slotSize / ObjectSlabGranularity - 1;
+	ObjectSlabCache* cache = GetObjectSlabCache();
+
+	ObjectSlabSlot* slot = static_cast< ObjectSlabSlot* >( memory );
+	slot->m_Next = cache->m_Free[ sizeClass ];
+	cache->m_Free[ sizeClass ] = slot;
+	if ( ++cache->m_Count[ sizeClass ] > ObjectSlabMaximumCached )
+	{
+		ReturnSlots( cache, sizeClass, ObjectSlabBatchSize );
+	}
+}
+
+int32_t ObjectSlab::GetLiveCount() const
+{
+	return m_Allocations - m_Frees;
+}
+
+uint32_t ObjectSlab::GetSlotSize() const
+{
+	if ( m_Alignment > HELIUM_SIMD_ALIGNMENT )
+	{
+		return 0;
+	}
+
+	// a free slot holds a link, and slot sizes stay multiples of the alignment so every slot of a chunk is aligned
+	uint32_t round = m_Alignment > ObjectSlabGranularity ? m_Alignment : ObjectSlabGranularity;
+	uint32_t size = m_Size > sizeof( ObjectSlabSlot ) ? m_Size : static_cast< uint32_t >( sizeof( ObjectSlabSlot ) );
+	size = ( size + round - 1 ) & ~( round - 1 );
+
+	return size <= ObjectSlabSizeClasses * ObjectSlabGranularity ? size : 0;
+}
+
+const ObjectSlab* ObjectSlab::GetFirst()
+{
+	return g_FirstObjectSlab;
+}
+
+void ObjectSlab::ReportStatistics()
+{
+	for ( const ObjectSlab* slab = g_FirstObjectSlab; slab; slab = slab->m_Next )
+	{
+		Log::Print( TXT( "Object slab %s: %d bytes in %d byte slots, %d live, %d allocated\n" ),
+			slab->m_Name, (int)slab->m_Size, (int)slab->GetSlotSize(), (int)slab->GetLiveCount(), (int)slab->m_Allocations );
+	}
+
+	if ( g_ObjectSlabClasses )
+	{
+		uint32_t chunks = 0;
+		for ( uint32_t i=0; i<ObjectSlabSizeClasses; ++i )
+		{
+			MutexScopeLock lock ( g_ObjectSlabClasses[ i ].m_Lock );
+			chunks += g_ObjectSlabClasses[ i ].m_Chunks;
+		}
+
+		Log::Print( TXT( "Object slabs: %d bytes reserved\n" ), (int)( chunks * ObjectSlabChunkSize ) );
+	}
+}
+
+void ObjectSlab::ReleaseThreadCache()
+{
+	ObjectSlabCache* cache = static_cast< ObjectSlabCache* >( g_ObjectSlabCache.GetPointer() );
+	if ( cache )
+	{
+		g_ObjectSlabCache.SetPointer( NULL );
+		ReleaseObjectSlabCache( cache );
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Platform/Types.h"
+
+#include "Reflect/API.h"
+
+namespace Helium
+{
+	namespace Reflect
+	{
+		//
+		// The alignment a type really needs (as opposed to HELIUM_SIMD_ALIGNMENT), usable as a constant
+		//
+
+		template< class T >
+		struct _AlignmentProbe
+		{
+			char m_Char;
+			T    m_Value;
+		};
+
+		template< class T >
+		struct AlignmentOf
+		{
+			enum { Value = sizeof( _AlignmentProbe< T > ) - sizeof( T ) };
+		};
+
+		//
+		// ObjectSlab is the allocator and statistics of a single pooled class
+		//  objects come from slabs shared by every class of the same size class (size rounded up to the alignment)
+		//  each thread caches free slots per size class, so most allocations and frees take no lock
+		//  it's an aggregate so classes can define theirs with static (constant) initialization
+		//
+
+		struct HELIUM_REFLECT_API ObjectSlab
+		{
+			const char*      m_Name;        // the name of the class
+			uint32_t         m_Size;        // sizeof the class (what its MetaClass records as m_Size)
+			uint32_t         m_Alignment;   // the alignment of the class
+			volatile int32_t m_Allocations; // objects allocated so far
+			volatile int32_t m_Frees;       // objects freed so far
+			volatile int32_t m_Listed;      // set once the slab is linked into the statistics list
+			ObjectSlab*      m_Next;        // the next slab that has allocated
+
+			void* Allocate();
+			void  Free( void* memory );
+
+			// objects currently allocated
+			int32_t GetLiveCount() const;
+
+			// the bytes each object really occupies, zero if the class is too big or too aligned to pool
+			uint32_t GetSlotSize() const;
+
+			// the slabs that have allocated, most recent first
+			static const ObjectSlab* GetFirst();
+
+			// log the statistics of every slab
+			static void ReportStatistics();
+
+			// give back the slots cached by the calling thread now (they are given back when the thread exits otherwise)
+			static void ReleaseThreadCache();
+		};
+	}
+}
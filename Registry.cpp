@@ -6,6 +6,7 @@
 
 #include "Foundation/Log.h"
 
+#include "Reflect/Dispatch.h"
 #include "Reflect/Object.h"
 #include "Reflect/TranslatorDeduction.h"
 
@@ -108,6 +109,12 @@ void Reflect::Cleanup()
 
         delete g_Registry;
         g_Registry = NULL;
+
+        ReleaseDispatchThreads();
+
+        Variable::ReleaseThreadPool();
+        ObjectSlab::ReleaseThreadCache();
+        ObjectRefCountSupport::ReleaseThreadCache();
     }
 
 #ifdef HELIUM_DEBUG_INIT_AND_CLEANUP
@@ -216,3 +223,34 @@ const MetaEnum* Registry::GetMetaEnum( uint32_t crc ) const
 {
     return ReflectionCast< const MetaEnum >( GetType( crc ) );
 }
+
+void Registry::ReportPropertyFootprint() const
+{
+    PropertyFootprint footprint;
+
+    M_HashToType::ConstIterator itr = m_TypesByHash.Begin();
+    M_HashToType::ConstIterator end = m_TypesByHash.End();
+    for ( ; itr != end; ++itr )
+    {
+        // skip aliases, each type is reported under its own name
+        const MetaStruct* structure = ReflectionCast< const MetaStruct >( itr->Second().Ptr() );
+        if ( structure && itr->First() == Crc32( structure->m_Name ) )
+        {
+            DynamicArray< Field >::ConstIterator fieldItr = structure->m_Fields.Begin();
+            DynamicArray< Field >::ConstIterator fieldEnd = structure->m_Fields.End();
+            for ( ; fieldItr != fieldEnd; ++fieldItr )
+            {
+                fieldItr->AccumulateFootprint( footprint );
+            }
+        }
+    }
+
+    Log::Print( TXT( "Field properties: %d fields, %d properties, %d bytes (%d bytes as std::map)\n" ),
+        (int)footprint.m_Collections, (int)footprint.m_Properties, (int)footprint.m_Bytes, (int)footprint.m_MapBytes );
+
+    if ( footprint.m_Collections )
+    {
+        Log::Print( TXT( "Field properties: %.1f bytes saved per field\n" ),
+            ( (float64_t)footprint.m_MapBytes - (float64_t)footprint.m_Bytes ) / (float64_t)footprint.m_Collections );
+    }
+}
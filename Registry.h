@@ -78,6 +78,9 @@ namespace Helium
             const MetaEnum* GetMetaEnum( uint32_t crc ) const;
             inline const MetaEnum* GetMetaEnum( const char* name ) const;
 
+            // log the property storage used by the fields of every registered structure
+            void ReportPropertyFootprint() const;
+
         private:
             M_HashToType        m_TypesByHash;
         };
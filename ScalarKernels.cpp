@@ -0,0 +1,88 @@
+#include "ReflectPch.h"
+#include "Reflect/ScalarKernels.h"
+
+#include <sstream>
+
+using namespace Helium;
+using namespace Helium::Reflect;
+
+// stream 8-bit integers as numbers rather than characters
+template< class T > struct ScalarStreamType         { typedef T        Type; };
+template<>          struct ScalarStreamType< uint8_t > { typedef uint16_t Type; };
+template<>          struct ScalarStreamType< int8_t >  { typedef int16_t  Type; };
+
+template< class T >
+static void CopyScalars( const void* src, void* dest, uint32_t count )
+{
+	const T* s = static_cast< const T* >( src );
+	T* d = static_cast< T* >( dest );
+	for ( uint32_t i=0; i<count; ++i )
+	{
+		d[ i ] = s[ i ];
+	}
+}
+
+template< class T >
+static bool EqualsScalars( const void* a, const void* b, uint32_t count )
+{
+	const T* left = static_cast< const T* >( a );
+	const T* right = static_cast< const T* >( b );
+	for ( uint32_t i=0; i<count; ++i )
+	{
+		if ( !( left[ i ] == right[ i ] ) )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+template< class T >
+static void PrintScalar( const void* value, String& string )
+{
+	typename ScalarStreamType< T >::Type v = *static_cast< const T* >( value );
+
+	std::stringstream str;
+	str << v;
+	string = str.str().c_str();
+}
+
+template< class T >
+static void ParseScalar( const String& string, void* value )
+{
+	typename ScalarStreamType< T >::Type v = typename ScalarStreamType< T >::Type ();
+
+	std::stringstream str ( string.GetData() );
+	str >> v;
+	*static_cast< T* >( value ) = static_cast< T >( v );
+}
+
+#define REFLECT_SCALAR_KERNEL( T ) { &CopyScalars< T >, &EqualsScalars< T >, &PrintScalar< T >, &ParseScalar< T > }
+
+static const ScalarKernel g_ScalarKernels[ ScalarTypes::String ] =
+{
+	REFLECT_SCALAR_KERNEL( bool ),
+	REFLECT_SCALAR_KERNEL( uint8_t ),
+	REFLECT_SCALAR_KERNEL( uint16_t ),
+	REFLECT_SCALAR_KERNEL( uint32_t ),
+	REFLECT_SCALAR_KERNEL( uint64_t ),
+	REFLECT_SCALAR_KERNEL( int8_t ),
+	REFLECT_SCALAR_KERNEL( int16_t ),
+	REFLECT_SCALAR_KERNEL( int32_t ),
+	REFLECT_SCALAR_KERNEL( int64_t ),
+	REFLECT_SCALAR_KERNEL( float32_t ),
+	REFLECT_SCALAR_KERNEL( float64_t ),
+};
+
+#undef REFLECT_SCALAR_KERNEL
+
+const ScalarKernel* Reflect::GetScalarKernel( ScalarType type )
+{
+	return IsNativeScalar( type ) ? &g_ScalarKernels[ type ] : NULL;
+}
+
+const ScalarKernel* Reflect::GetScalarKernel( Translator* translator )
+{
+	ScalarTranslator* scalar = ReflectionCast< ScalarTranslator >( translator );
+	return scalar ? GetScalarKernel( scalar->m_Type ) : NULL;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Reflect/Translator.h"
+#include "Reflect/MetaStruct.h"
+
+namespace Helium
+{
+	namespace Reflect
+	{
+		//
+		// Native storage for each fixed size ScalarType (String has no single native representation)
+		//
+
+		template< ScalarType Type > struct ScalarNativeType;
+		template<> struct ScalarNativeType< ScalarTypes::Boolean >    { typedef bool      Type; };
+		template<> struct ScalarNativeType< ScalarTypes::Unsigned8 >  { typedef uint8_t   Type; };
+		template<> struct ScalarNativeType< ScalarTypes::Unsigned16 > { typedef uint16_t  Type; };
+		template<> struct ScalarNativeType< ScalarTypes::Unsigned32 > { typedef uint32_t  Type; };
+		template<> struct ScalarNativeType< ScalarTypes::Unsigned64 > { typedef uint64_t  Type; };
+		template<> struct ScalarNativeType< ScalarTypes::Signed8 >    { typedef int8_t    Type; };
+		template<> struct ScalarNativeType< ScalarTypes::Signed16 >   { typedef int16_t   Type; };
+		template<> struct ScalarNativeType< ScalarTypes::Signed32 >   { typedef int32_t   Type; };
+		template<> struct ScalarNativeType< ScalarTypes::Signed64 >   { typedef int64_t   Type; };
+		template<> struct ScalarNativeType< ScalarTypes::Float32 >    { typedef float32_t Type; };
+		template<> struct ScalarNativeType< ScalarTypes::Float64 >    { typedef float64_t Type; };
+
+		// is the scalar type stored as a fixed size native value
+		inline bool IsNativeScalar( ScalarType type );
+
+		//
+		// Statically typed operations over contiguous native scalar values, indexed by ScalarType
+		//
+
+		struct HELIUM_REFLECT_API ScalarKernel
+		{
+			typedef void (*CopyFunc)( const void* src, void* dest, uint32_t count );
+			typedef bool (*EqualsFunc)( const void* a, const void* b, uint32_t count );
+			typedef void (*PrintFunc)( const void* value, String& string );
+			typedef void (*ParseFunc)( const String& string, void* value );
+
+			CopyFunc   m_Copy;
+			EqualsFunc m_Equals;
+			PrintFunc  m_Print;
+			ParseFunc  m_Parse;
+		};
+
+		// the kernel for a scalar type, NULL if the type has no native representation
+		HELIUM_REFLECT_API const ScalarKernel* GetScalarKernel( ScalarType type );
+
+		// the kernel for the data handled by a translator, NULL if it isn't a native scalar
+		HELIUM_REFLECT_API const ScalarKernel* GetScalarKernel( Translator* translator );
+
+		//
+		// Typed dispatch: switch once on the scalar type, then run statically typed code
+		//  native scalars call visitor.VisitScalars( field, T* values, count )
+		//  all other data calls visitor.VisitData( field, pointer ) for each element
+		//
+
+		template< class VisitorT >
+		void DispatchScalars( ScalarType type, const Field* field, void* values, uint32_t count, VisitorT& visitor );
+
+		template< class VisitorT >
+		void VisitFieldsTyped( const MetaStruct* structure, void* composite, Object* object, VisitorT& visitor );
+	}
+}
+
+#include "Reflect/ScalarKernels.inl"
@@ -0,0 +1,87 @@
+bool Helium::Reflect::IsNativeScalar( ScalarType type )
+{
+	return type < ScalarTypes::String;
+}
+
+template< class VisitorT >
+void Helium::Reflect::DispatchScalars( ScalarType type, const Field* field, void* values, uint32_t count, VisitorT& visitor )
+{
+	switch ( type )
+	{
+	case ScalarTypes::Boolean:
+		visitor.VisitScalars( field, static_cast< bool* >( values ), count );
+		break;
+
+	case ScalarTypes::Unsigned8:
+		visitor.VisitScalars( field, static_cast< uint8_t* >( values ), count );
+		break;
+
+	case ScalarTypes::Unsigned16:
+		visitor.VisitScalars( field, static_cast< uint16_t* >( values ), count );
+		break;
+
+	case ScalarTypes::Unsigned32:
+		visitor.VisitScalars( field, static_cast< uint32_t* >( values ), count );
+		break;
+
+	case ScalarTypes::Unsigned64:
+		visitor.VisitScalars( field, static_cast< uint64_t* >( values ), count );
+		break;
+
+	case ScalarTypes::Signed8:
+		visitor.VisitScalars( field, static_cast< int8_t* >( values ), count );
+		break;
+
+	case ScalarTypes::Signed16:
+		visitor.VisitScalars( field, static_cast< int16_t* >( values ), count );
+		break;
+
+	case ScalarTypes::Signed32:
+		visitor.VisitScalars( field, static_cast< int32_t* >( values ), count );
+		break;
+
+	case ScalarTypes::Signed64:
+		visitor.VisitScalars( field, static_cast< int64_t* >( values ), count );
+		break;
+
+	case ScalarTypes::Float32:
+		visitor.VisitScalars( field, static_cast< float32_t* >( values ), count );
+		break;
+
+	case ScalarTypes::Float64:
+		visitor.VisitScalars( field, static_cast< float64_t* >( values ), count );
+		break;
+
+	default:
+		HELIUM_ASSERT( false );
+		break;
+	}
+}
+
+template< class VisitorT >
+void Helium::Reflect::VisitFieldsTyped( const MetaStruct* structure, void* composite, Object* object, VisitorT& visitor )
+{
+	for ( const MetaStruct* current = structure; current != NULL; current = current->m_Base )
+	{
+		DynamicArray< Field >::ConstIterator itr = current->m_Fields.Begin();
+		DynamicArray< Field >::ConstIterator end = current->m_Fields.End();
+		for ( ; itr != end; ++itr )
+		{
+			const Field* field = &*itr;
+
+			ScalarTranslator* scalar = ReflectionCast< ScalarTranslator >( field->m_Translator.Ptr() );
+			if ( scalar && IsNativeScalar( scalar->m_Type ) )
+			{
+				Pointer pointer ( field, composite, object );
+				DispatchScalars( scalar->m_Type, field, pointer.m_Address, field->m_Count, visitor );
+			}
+			else
+			{
+				for ( uint32_t i=0; i<field->m_Count; ++i )
+				{
+					visitor.VisitData( field, Pointer( field, composite, object, i ) );
+				}
+			}
+		}
+	}
+}
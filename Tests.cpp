@@ -3,11 +3,27 @@
 
 #if !HELIUM_RELEASE
 
+#include "Platform/Atomic.h"
+#include "Platform/Thread.h"
+#include "Platform/Timer.h"
+
 #include "Foundation/Log.h"
+#include "Foundation/MemoryStream.h"
+
+#include "Reflect/Dispatch.h"
+#include "Reflect/ObjectChanges.h"
+#include "Reflect/ObjectSampling.h"
+#include "Reflect/ScalarKernels.h"
 
 HELIUM_DEFINE_ENUM( Helium::Reflect::TestEnumeration );
 HELIUM_DEFINE_BASE_STRUCT( Helium::Reflect::TestStructure );
+HELIUM_DEFINE_BASE_STRUCT( Helium::Reflect::TestStaticStructure );
+HELIUM_DEFINE_BASE_STRUCT( Helium::Reflect::TestStaticNestingStructure );
 HELIUM_DEFINE_CLASS( Helium::Reflect::TestObject );
+HELIUM_DEFINE_POOLED_CLASS( Helium::Reflect::TestPooledObject );
+HELIUM_DEFINE_CLASS( Helium::Reflect::TestInlineObject );
+HELIUM_DEFINE_COPYABLE_CLASS( Helium::Reflect::TestCopyableObject );
+HELIUM_DEFINE_CLASS( Helium::Reflect::TestGraphObject );
 
 using namespace Helium;
 using namespace Reflect;
@@ -60,6 +76,36 @@ void TestStructure::PopulateMetaType( Reflect::MetaStruct& comp )
 	comp.AddField( &TestStructure::m_FoundationDynamicArrayUint32, "Dynamic Array of Signed 32-bit Integers" );
 	comp.AddField( &TestStructure::m_FoundationSetUint32, "Set of Unsigned 32-bit Integers" );
 	comp.AddField( &TestStructure::m_FoundationMapUint32, "Map of Unsigned 32-bit Integers" );
+
+	comp.AddField( &TestStructure::m_StdUnorderedSetUint32, "std::unordered_set of Unsigned 32-bit Integers" );
+	comp.AddField( &TestStructure::m_StdUnorderedMapUint32, "std::unordered_map of Unsigned 32-bit Integers" );
+
+	comp.AddField( &TestStructure::m_FoundationHashSetUint32, "Hash Set of Unsigned 32-bit Integers" );
+	comp.AddField( &TestStructure::m_FoundationHashMapUint32, "Hash Map of Unsigned 32-bit Integers" );
+}
+
+TestStaticStructure::TestStaticStructure()
+	: m_Uint32( 0 )
+	, m_Int16( 0 )
+	, m_Float32( 0 )
+	, m_Scratch( 0 )
+{
+	MemoryZero( m_Float64Array, sizeof( m_Float64Array ) );
+}
+
+void TestStaticStructure::PopulateMetaType( Reflect::MetaStruct& comp )
+{
+	comp.AddStaticFields< TestStaticStructure >();
+}
+
+TestStaticNestingStructure::TestStaticNestingStructure()
+	: m_Count( 0 )
+{
+}
+
+void TestStaticNestingStructure::PopulateMetaType( Reflect::MetaStruct& comp )
+{
+	comp.AddStaticFields< TestStaticNestingStructure >();
 }
 
 void TestObject::PopulateMetaType( Reflect::MetaClass& comp )
@@ -71,12 +117,57 @@ void TestObject::PopulateMetaType( Reflect::MetaClass& comp )
 	comp.AddField( &TestObject::m_EnumerationArray, "MetaEnum Array" );
 
 	comp.AddMethod( &TestObject::TestFunction, "Test Function" );
+	comp.AddMethod( &TestObject::ThrowingFunction, "Throwing Function" );
 }
 
 TestObject::TestObject()
 {
 }
 
+TestPooledObject::TestPooledObject()
+	: m_Value( 0 )
+{
+}
+
+void TestPooledObject::PopulateMetaType( Reflect::MetaClass& comp )
+{
+	comp.AddField( &TestPooledObject::m_Value, "Value" );
+}
+
+TestInlineObject::TestInlineObject()
+	: m_Value( 0 )
+{
+}
+
+void TestInlineObject::PopulateMetaType( Reflect::MetaClass& comp )
+{
+	comp.AddField( &TestInlineObject::m_Value, "Value" );
+}
+
+TestCopyableObject::TestCopyableObject()
+	: m_Value( 0 )
+{
+}
+
+void TestCopyableObject::PopulateMetaType( Reflect::MetaClass& comp )
+{
+	comp.AddField( &TestCopyableObject::m_Value,  "Value" );
+	comp.AddField( &TestCopyableObject::m_Values, "Values" );
+}
+
+TestGraphObject::TestGraphObject()
+	: m_Value( 0 )
+{
+}
+
+void TestGraphObject::PopulateMetaType( Reflect::MetaClass& comp )
+{
+	comp.AddField( &TestGraphObject::m_Value,    "Value" );
+	comp.AddField( &TestGraphObject::m_Left,     "Left" );
+	comp.AddField( &TestGraphObject::m_Right,    "Right" );
+	comp.AddField( &TestGraphObject::m_Children, "Children" );
+}
+
 void TestObject::TestFunction( TestStructure& args )
 {
 	// verify vtable is intact
@@ -98,15 +189,1481 @@ void TestObject::TestFunction( TestStructure& args )
 	HELIUM_ASSERT( def->m_Float64 == args.m_Float64 );
 }
 
+void TestObject::ThrowingFunction( TestStructure& /*args*/ )
+{
+	if ( m_Struct.m_Uint32 % 7 == 0 )
+	{
+		if ( m_Struct.m_Uint32 % 2 )
+		{
+			throw 7;
+		}
+		throw Reflect::Exception( TXT( "Object %u" ), m_Struct.m_Uint32 );
+	}
+}
+
+class TestVisitor : public Visitor
+{
+public:
+	TestVisitor()
+		: m_Fields( 0 )
+		, m_Items( 0 )
+		, m_Pairs( 0 )
+	{
+	}
+
+	virtual bool VisitField( const Field* field, Pointer pointer ) HELIUM_OVERRIDE
+	{
+		++m_Fields;
+		return true;
+	}
+
+	virtual bool VisitItem( Pointer item, Translator* translator ) HELIUM_OVERRIDE
+	{
+		++m_Items;
+		return true;
+	}
+
+	virtual bool VisitPair( Pointer key, ScalarTranslator* keyTranslator, Pointer value, Translator* valueTranslator ) HELIUM_OVERRIDE
+	{
+		++m_Pairs;
+		return true;
+	}
+
+	uint32_t m_Fields;
+	uint32_t m_Items;
+	uint32_t m_Pairs;
+};
+
+// the change notifications received, and the last one
+static uint32_t     g_ChangeCount = 0;
+static const Field* g_ChangeField = NULL;
+static FieldBitSet  g_ChangeFields;
+static bool         g_ChangeCoalesced = false;
+
+static void CountChange( const ObjectChangeArgs& args )
+{
+	++g_ChangeCount;
+	g_ChangeField = args.m_Field;
+	g_ChangeCoalesced = args.m_Fields != NULL;
+	if ( args.m_Fields )
+	{
+		g_ChangeFields = *args.m_Fields;
+	}
+}
+
+static volatile int32_t g_RangeCount = 0;
+
+// listens to the objects of the context or tracks their dirty fields, every range of as many indices as objects
+//  walks them in the same order, so the threads flag each object at about the same time
+static void FlagObjectsInRange( void* context, size_t begin, size_t end )
+{
+	DynamicArray< StrongPtr< TestGraphObject > >& objects = *static_cast< DynamicArray< StrongPtr< TestGraphObject > >* >( context );
+	for ( size_t i=begin; i<end; ++i )
+	{
+		TestGraphObject* object = objects[ i % objects.GetSize() ];
+		if ( ( i / objects.GetSize() ) % 2 )
+		{
+			object->AddChangedListener( ObjectChangeSignature::Delegate( &CountChange ) );
+		}
+		else
+		{
+			object->TrackDirtyFields();
+		}
+	}
+}
+
+// counts the indices of a parallel range, throwing at index 500 (a Reflect::Exception with a context, anything else without)
+static void ThrowInRange( void* context, size_t begin, size_t end )
+{
+	AtomicAddRelease( g_RangeCount, static_cast< int32_t >( end - begin ) );
+	if ( begin <= 500 && 500 < end )
+	{
+		if ( context )
+		{
+			throw Reflect::Exception( TXT( "Index %d" ), 500 );
+		}
+		throw 500;
+	}
+}
+
+static void TestSequence( Translator* translator, Pointer sequence )
+{
+	SequenceTranslator* sequenceTranslator = ReflectionCast< SequenceTranslator >( translator );
+	HELIUM_ASSERT( sequenceTranslator );
+
+	uint32_t values[] = { 0, 1, 2, 3 };
+	sequenceTranslator->Reserve( sequence, 8 );
+	sequenceTranslator->AppendRange( sequence, &values[ 2 ], 2 );
+	sequenceTranslator->InsertRange( sequence, 0, &values[ 0 ], 2 );
+	sequenceTranslator->AppendRange( sequence, &values[ 0 ], 4 );
+	sequenceTranslator->RemoveRange( sequence, 4, 4 );
+	HELIUM_ASSERT( sequenceTranslator->GetLength( sequence ) == 4 );
+
+	Set< size_t > items;
+	items.Insert( 1 );
+	items.Insert( 2 );
+	sequenceTranslator->MoveUp( sequence, items );
+	HELIUM_ASSERT( sequenceTranslator->GetItem( sequence, 0 ).As< uint32_t >() == 1 );
+	HELIUM_ASSERT( sequenceTranslator->GetItem( sequence, 1 ).As< uint32_t >() == 2 );
+	HELIUM_ASSERT( sequenceTranslator->GetItem( sequence, 2 ).As< uint32_t >() == 0 );
+
+	sequenceTranslator->MoveDown( sequence, items );
+	uint32_t expected[] = { 1, 3, 2, 0 };
+	for ( uint32_t i=0; i<4; ++i )
+	{
+		HELIUM_ASSERT( sequenceTranslator->GetItem( sequence, i ).As< uint32_t >() == expected[ i ] );
+	}
+
+	// one cycle through every item
+	DynamicArray< size_t > order;
+	order.Add( 3 );
+	order.Add( 0 );
+	order.Add( 1 );
+	order.Add( 2 );
+	sequenceTranslator->Reorder( sequence, order );
+	uint32_t reordered[] = { 0, 1, 3, 2 };
+	for ( uint32_t i=0; i<4; ++i )
+	{
+		HELIUM_ASSERT( sequenceTranslator->GetItem( sequence, i ).As< uint32_t >() == reordered[ i ] );
+	}
+}
+
+class TestTypedVisitor
+{
+public:
+	TestTypedVisitor()
+		: m_Scalars( 0 )
+		, m_Data( 0 )
+	{
+	}
+
+	template< class T >
+	void VisitScalars( const Field* field, T* values, uint32_t count )
+	{
+		m_Scalars += count;
+	}
+
+	void VisitData( const Field* field, Pointer pointer )
+	{
+		++m_Data;
+	}
+
+	uint32_t m_Scalars;
+	uint32_t m_Data;
+};
+
 void Reflect::RunTests()
 {
 	StrongPtr< Object > object = new TestObject ();
 
-	const Reflect::Method& m = object->GetMetaClass()->m_Methods.GetFirst();
-	void* args = alloca(m.m_Translator->m_Size);
-	m.m_Translator->Construct( args );
-	static_cast< Invokable* >( m.m_Delegate )->Invoke( args, object.Ptr() );
-	m.m_Translator->Destruct( args );
+	{
+		TestStructure& structure = static_cast< TestObject* >( object.Ptr() )->m_Struct;
+		structure.m_StdVectorUint32.push_back( 1 );
+		structure.m_StdSetUint32.insert( 2 );
+		structure.m_StdMapUint32[ 3 ] = 4;
+		structure.m_FoundationDynamicArrayUint32.Add( 5 );
+		structure.m_FoundationSetUint32.Insert( 6 );
+		structure.m_FoundationMapUint32[ 7 ] = 8;
+		structure.m_StdUnorderedSetUint32.insert( 9 );
+		structure.m_StdUnorderedMapUint32[ 10 ] = 11;
+		structure.m_FoundationHashSetUint32.Insert( 12 );
+		structure.m_FoundationHashMapUint32.Insert( HashMap< uint32_t, uint32_t >::ValueType( 13, 14 ) );
+
+		TestVisitor visitor;
+		object->GetMetaClass()->Visit( object.Ptr(), object.Ptr(), visitor );
+		HELIUM_ASSERT( visitor.m_Fields == 1 + 8 + 1 + 8 + 9 * 20 );
+		HELIUM_ASSERT( visitor.m_Items == 6 );
+		HELIUM_ASSERT( visitor.m_Pairs == 4 );
+	}
+
+	{
+		std::vector< uint32_t > stdVector;
+		SmartPtr< Translator > stdVectorTranslator = AllocateTranslator< std::vector< uint32_t > >();
+		TestSequence( stdVectorTranslator.Ptr(), &stdVector );
+
+		DynamicArray< uint32_t > dynamicArray;
+		SmartPtr< Translator > dynamicArrayTranslator = AllocateTranslator< DynamicArray< uint32_t > >();
+		TestSequence( dynamicArrayTranslator.Ptr(), &dynamicArray );
+	}
+
+	{
+		TestStructure structure;
+		TestTypedVisitor visitor;
+		VisitFieldsTyped( GetMetaStruct< TestStructure >(), &structure, NULL, visitor );
+		HELIUM_ASSERT( visitor.m_Scalars == 10 );
+		HELIUM_ASSERT( visitor.m_Data == 10 );
+
+		TestStructure copy;
+		structure.m_Float64 = 1.0;
+		GetMetaStruct< TestStructure >()->Copy( &structure, NULL, &copy, NULL );
+		HELIUM_ASSERT( GetMetaStruct< TestStructure >()->Equals( &structure, NULL, &copy, NULL ) );
+	}
+
+	{
+		// moves leave containers, strings and pointers empty, and scalars as they were
+		SmartPtr< Translator > scalarTranslator = AllocateTranslator< uint32_t >();
+		uint32_t scalarSource = 3, scalarDestination = 5;
+		scalarTranslator->Move( Pointer( &scalarSource ), Pointer( &scalarDestination ) );
+		HELIUM_ASSERT( scalarDestination == 3 && scalarSource == 3 );
+		scalarSource = 7;
+		scalarTranslator->Swap( Pointer( &scalarSource ), Pointer( &scalarDestination ) );
+		HELIUM_ASSERT( scalarDestination == 7 && scalarSource == 3 );
+
+		SmartPtr< Translator > stringTranslator = AllocateTranslator< std::string >();
+		std::string stringSource = "source", stringDestination = "destination";
+		stringTranslator->Move( Pointer( &stringSource ), Pointer( &stringDestination ) );
+		HELIUM_ASSERT( stringDestination == "source" && stringSource.empty() );
+		stringSource = "other";
+		stringTranslator->Swap( Pointer( &stringSource ), Pointer( &stringDestination ) );
+		HELIUM_ASSERT( stringDestination == "other" && stringSource == "source" );
+
+		SmartPtr< Translator > arrayTranslator = AllocateTranslator< DynamicArray< uint32_t > >();
+		DynamicArray< uint32_t > arraySource, arrayDestination;
+		arraySource.Add( 1 );
+		arraySource.Add( 2 );
+		arrayDestination.Add( 9 );
+		arrayTranslator->Move( Pointer( &arraySource ), Pointer( &arrayDestination ) );
+		HELIUM_ASSERT( arrayDestination.GetSize() == 2 && arrayDestination[ 1 ] == 2 && arraySource.IsEmpty() );
+		arraySource.Add( 4 );
+		arrayTranslator->Swap( Pointer( &arraySource ), Pointer( &arrayDestination ) );
+		HELIUM_ASSERT( arrayDestination.GetSize() == 1 && arrayDestination[ 0 ] == 4 && arraySource.GetSize() == 2 );
+
+		SmartPtr< Translator > vectorTranslator = AllocateTranslator< std::vector< uint32_t > >();
+		std::vector< uint32_t > vectorSource ( 2, 1 ), vectorDestination ( 1, 9 );
+		vectorTranslator->Move( Pointer( &vectorSource ), Pointer( &vectorDestination ) );
+		HELIUM_ASSERT( vectorDestination.size() == 2 && vectorDestination[ 0 ] == 1 && vectorSource.empty() );
+
+		SmartPtr< Translator > pointerTranslator = AllocateTranslator< StrongPtr< TestGraphObject > >();
+		StrongPtr< TestGraphObject > pointerSource = new TestGraphObject (), pointerDestination = new TestGraphObject ();
+		TestGraphObject* pointee = pointerSource;
+		pointerTranslator->Move( Pointer( &pointerSource ), Pointer( &pointerDestination ) );
+		HELIUM_ASSERT( pointerDestination.Ptr() == pointee && !pointerSource.Ptr() && pointee->GetRefCountProxy()->GetStrongRefCount() == 1 );
+		pointerSource = new TestGraphObject ();
+		pointerTranslator->Swap( Pointer( &pointerSource ), Pointer( &pointerDestination ) );
+		HELIUM_ASSERT( pointerSource.Ptr() == pointee && pointerDestination.Ptr() != pointee );
+
+		// moving into sequences and associations
+		SmartPtr< Translator > stringsTranslator = AllocateTranslator< DynamicArray< std::string > >();
+		SequenceTranslator* sequence = ReflectionCast< SequenceTranslator >( stringsTranslator.Ptr() );
+		DynamicArray< std::string > strings;
+		strings.Add( "first" );
+		std::string item = "second";
+		sequence->InsertByMove( Pointer( &strings ), 0, Pointer( &item ) );
+		HELIUM_ASSERT( strings.GetSize() == 2 && strings[ 0 ] == "second" && strings[ 1 ] == "first" && item.empty() );
+		item = "third";
+		sequence->SetItemByMove( Pointer( &strings ), 1, Pointer( &item ) );
+		HELIUM_ASSERT( strings.GetSize() == 2 && strings[ 1 ] == "third" && item.empty() );
+
+		SmartPtr< Translator > mapTranslator = AllocateTranslator< HashMap< uint32_t, std::string > >();
+		AssociationTranslator* association = ReflectionCast< AssociationTranslator >( mapTranslator.Ptr() );
+		HashMap< uint32_t, std::string > map;
+		uint32_t key = 1;
+		item = "value";
+		association->SetItemByMove( Pointer( &map ), Pointer( &key ), Pointer( &item ) );
+		HELIUM_ASSERT( map.GetSize() == 1 && map.Find( 1 )->Second() == "value" && item.empty() );
+		item = "replaced";
+		association->SetItemByMove( Pointer( &map ), Pointer( &key ), Pointer( &item ) );
+		HELIUM_ASSERT( map.GetSize() == 1 && map.Find( 1 )->Second() == "replaced" && item.empty() );
+
+		SmartPtr< Translator > stlMapTranslator = AllocateTranslator< std::map< uint32_t, std::vector< uint32_t > > >();
+		std::map< uint32_t, std::vector< uint32_t > > stlMap;
+		std::vector< uint32_t > values ( 3, 7 );
+		ReflectionCast< AssociationTranslator >( stlMapTranslator.Ptr() )->SetItemByMove( Pointer( &stlMap ), Pointer( &key ), Pointer( &values ) );
+		HELIUM_ASSERT( stlMap[ 1 ].size() == 3 && values.empty() );
+	}
+
+	{
+		// reordering swaps items rather than copy them, so each string keeps its buffer
+		DynamicArray< std::string > strings;
+		const char* buffers[ 3 ];
+		for ( uint32_t i=0; i<3; ++i )
+		{
+			strings.Add( std::string( 64, static_cast< char >( 'a' + i ) ) );
+			buffers[ i ] = strings[ i ].c_str();
+		}
+
+		SmartPtr< Translator > translator = AllocateTranslator< DynamicArray< std::string > >();
+		DynamicArray< size_t > order;
+		order.Add( 2 );
+		order.Add( 1 );
+		order.Add( 0 );
+		ReflectionCast< SequenceTranslator >( translator.Ptr() )->Reorder( Pointer( &strings ), order );
+		HELIUM_ASSERT( strings[ 0 ][ 0 ] == 'c' && strings[ 1 ][ 0 ] == 'b' && strings[ 2 ][ 0 ] == 'a' );
+		HELIUM_ASSERT( strings[ 0 ].c_str() == buffers[ 2 ] && strings[ 2 ].c_str() == buffers[ 0 ] );
+	}
+
+	{
+		SmartPtr< Translator > scalarTranslator = AllocateTranslator< uint32_t >();
+		SmartPtr< Translator > structureTranslator = AllocateTranslator< TestStructure >();
+
+		int32_t heapAllocations = Variable::GetHeapAllocationCount();
+		for ( uint32_t i=0; i<4; ++i )
+		{
+			Variable scalar ( scalarTranslator.Ptr() );
+			Variable structure ( structureTranslator.Ptr() );
+		}
+		HELIUM_ASSERT( Variable::GetHeapAllocationCount() - heapAllocations <= 1 );
+	}
+
+	{
+		HashMap< uint32_t, uint32_t > hashMap;
+		SmartPtr< Translator > translator = AllocateTranslator< HashMap< uint32_t, uint32_t > >();
+		AssociationTranslator* association = ReflectionCast< AssociationTranslator >( translator.Ptr() );
+
+		uint32_t key = 1, value = 2;
+		association->Reserve( &hashMap, 16 );
+		association->SetItem( &hashMap, &key, &value );
+		HELIUM_ASSERT( association->GetLength( &hashMap ) == 1 );
+		HELIUM_ASSERT( association->GetItem( &hashMap, &key ).As< uint32_t >() == value );
+	}
+
+	{
+		const MetaStruct* structure = GetMetaStruct< TestStaticStructure >();
+		HELIUM_ASSERT( structure->m_Fields.GetSize() == 5 );
+		HELIUM_ASSERT( structure->m_Static.m_Copy && structure->m_Static.m_Hash && structure->m_Static.m_Read );
+
+		TestStaticStructure source, destination;
+		source.m_Uint32 = 1;
+		source.m_Int16 = -2;
+		source.m_Float32 = 3.f;
+		source.m_Float64Array[ 3 ] = 4.0;
+		structure->Copy( &source, NULL, &destination, NULL );
+		HELIUM_ASSERT( structure->Equals( &source, NULL, &destination, NULL ) );
+
+		uint32_t sourceHash = 0, destinationHash = 0;
+		HELIUM_VERIFY( structure->Hash( &source, sourceHash ) );
+		HELIUM_VERIFY( structure->Hash( &destination, destinationHash ) );
+		HELIUM_ASSERT( sourceHash == destinationHash );
+
+		DynamicArray< uint8_t > buffer;
+		DynamicMemoryStream writeStream ( &buffer );
+		HELIUM_VERIFY( structure->Write( &source, writeStream ) );
+
+		TestStaticStructure read;
+		StaticMemoryStream readStream ( buffer.GetData(), buffer.GetSize() );
+		HELIUM_VERIFY( structure->Read( &read, readStream ) );
+		HELIUM_ASSERT( structure->Equals( &source, NULL, &read, NULL ) );
+
+		// discarded fields stay out of the stream
+		HELIUM_ASSERT( buffer.GetSize() == sizeof( uint32_t ) + sizeof( int16_t ) + sizeof( float32_t ) + sizeof( source.m_Float64Array ) );
+		source.m_Scratch = 5;
+		buffer.Clear();
+		DynamicMemoryStream scratchStream ( &buffer );
+		HELIUM_VERIFY( structure->Write( &source, scratchStream ) );
+		StaticMemoryStream scratchReadStream ( buffer.GetData(), buffer.GetSize() );
+		HELIUM_VERIFY( structure->Read( &read, scratchReadStream ) );
+		HELIUM_ASSERT( read.m_Scratch == 0 && !structure->Equals( &source, NULL, &read, NULL ) );
+
+		// nested structures compare through their translator
+		const MetaStruct* nesting = GetMetaStruct< TestStaticNestingStructure >();
+		HELIUM_ASSERT( nesting->m_Static.m_Equals && !nesting->m_Static.m_Write );
+		TestStaticNestingStructure outer, other;
+		HELIUM_ASSERT( nesting->Equals( &outer, NULL, &other, NULL ) );
+		other.m_Nested.m_Float64Array[ 2 ] = 1.0;
+		HELIUM_ASSERT( !nesting->Equals( &outer, NULL, &other, NULL ) );
+
+		// containers have no static hash or stream form
+		TestStructure containers;
+		uint32_t hash = 0;
+		HELIUM_ASSERT( !GetMetaStruct< TestStructure >()->Hash( &containers, hash ) );
+		HELIUM_ASSERT( hash == 0 );
+		HELIUM_ASSERT( !GetMetaStruct< TestStructure >()->Write( &containers, writeStream ) );
+	}
+
+	{
+		const MetaEnum* enumeration = GetMetaEnum< TestEnumeration >();
+		uint32_t value = 0;
+		HELIUM_VERIFY( enumeration->GetValue( "Value Two", value ) );
+		HELIUM_ASSERT( value == TestEnumeration::ValueTwo );
+		HELIUM_ASSERT( enumeration->IsValid( TestEnumeration::ValueTwo ) && !enumeration->IsValid( 5 ) );
+	}
+
+	{
+		SmartPtr< MetaEnum > flags = new MetaEnum ();
+		flags->AddElement( 1, "Low" );
+		flags->AddElement( 1ull << 40, "High" );
+		flags->AddElement( 1ull << 63, "Top" );
+		HELIUM_ASSERT( flags->m_IsBitfield );
+
+		char buffer[ 32 ];
+		size_t length = 0;
+		HELIUM_VERIFY( flags->Format( ( 1ull << 63 ) | ( 1ull << 40 ) | 1, buffer, sizeof( buffer ), length ) );
+		HELIUM_ASSERT( length == 12 && std::string( buffer ) == "Low|High|Top" );
+
+		uint64_t value = 0;
+		HELIUM_VERIFY( flags->Parse( buffer, 8, value ) );
+		HELIUM_ASSERT( value == ( ( 1ull << 40 ) | 1 ) );
+
+		// truncated output still reports the full length
+		HELIUM_VERIFY( flags->Format( ( 1ull << 63 ) | 1, buffer, 6, length ) );
+		HELIUM_ASSERT( length == 7 && std::string( buffer ) == "Low|T" );
+
+		// elements added after lookups are found once the stale tables are rebuilt
+		flags->AddElement( 1ull << 8, "Middle" );
+		HELIUM_VERIFY( flags->Format( ( 1ull << 8 ) | 1, buffer, sizeof( buffer ), length ) );
+		HELIUM_ASSERT( std::string( buffer ) == "Low|Middle" );
+		HELIUM_VERIFY( flags->GetValue( "Middle", value ) && value == ( 1ull << 8 ) );
+		HELIUM_ASSERT( flags->IsValid( 1ull << 8 ) );
+	}
+
+	{
+		const Field* field = GetMetaStruct< TestStructure >()->FindFieldByName( Crc32( "Unsigned 32-bit Integer" ) );
+		field->SetProperty( "UIName", std::string( "Count" ) );
+		field->SetProperty( "Minimum", 1 );
+		field->SetProperty( "Maximum", 100 );
+
+		int32_t maximum = 0;
+		HELIUM_VERIFY( field->GetProperty( "Maximum", maximum ) );
+		HELIUM_ASSERT( maximum == 100 );
+		HELIUM_ASSERT( field->GetProperty( "UIName" ) == "Count" );
+		HELIUM_ASSERT( field->GetProperty( "Missing" ).empty() );
+
+		const PropertyKey scaleKey ( "Scale" );
+		field->SetProperty( scaleKey, 0.5f );
+		field->SetProperty( "Enabled", std::string( "true" ) );
+
+		float32_t scale = 0.f;
+		bool enabled = false;
+		HELIUM_VERIFY( field->GetProperty( scaleKey, scale ) );
+		HELIUM_VERIFY( field->GetProperty( "Enabled", enabled ) );
+		HELIUM_ASSERT( scale == 0.5f && enabled );
+		HELIUM_ASSERT( !field->GetProperty( "UIName", maximum ) );
+
+		Field copy = *field;
+		HELIUM_ASSERT( copy.GetProperty( "Minimum" ) == "1" );
+
+		// unsigned values too large for int64_t keep their value, set directly or as strings
+		uint64_t large = 0;
+		field->SetProperty( "Large", ~0ull );
+		HELIUM_ASSERT( field->GetProperty( "Large" ) == "18446744073709551615" );
+		HELIUM_VERIFY( field->GetProperty( "Large", large ) );
+		HELIUM_ASSERT( large == ~0ull );
+		HELIUM_ASSERT( !field->GetProperty( "Large", maximum ) );
+		field->SetProperty( "Large", std::string( "18446744073709551614" ) );
+		HELIUM_VERIFY( field->GetProperty( "Large", large ) );
+		HELIUM_ASSERT( large == ~0ull - 1 );
+
+		// a key built from a temporary string owns its name
+		const PropertyKey stringKey ( std::string( "Temporary" ) + "Key" );
+		field->SetProperty( stringKey, 3 );
+		HELIUM_ASSERT( field->GetProperty( "TemporaryKey" ) == "3" );
+
+		// rewriting a property replaces (and frees) its block each time
+		for ( uint32_t i=0; i<1000; ++i )
+		{
+			field->SetProperty( "Maximum", i );
+		}
+		HELIUM_VERIFY( field->GetProperty( "Maximum", maximum ) );
+		HELIUM_ASSERT( maximum == 999 );
+
+		// a value found inside a read scope outlives the writes made meanwhile (assigning a collection replaces its block too)
+		{
+			PropertyReadScope scope;
+			const PropertyValue* value = field->FindPropertyValue( "Maximum" );
+			HELIUM_ASSERT( value );
+			for ( uint32_t i=0; i<100; ++i )
+			{
+				field->SetProperty( "Maximum", i );
+			}
+			PropertyCollection copy;
+			copy = *field;
+			copy = *field;
+			HELIUM_ASSERT( value->m_String == "999" && copy.GetProperty( "Maximum" ) == "99" );
+		}
+		HELIUM_VERIFY( field->GetProperty( "Maximum", maximum ) );
+		HELIUM_ASSERT( maximum == 99 );
+
+		Registry::GetInstance()->ReportPropertyFootprint();
+	}
+
+	{
+		const Reflect::Method* method = object->GetMetaClass()->FindMethodByName( Crc32( "Test Function" ) );
+		HELIUM_ASSERT( method );
+		method->Invoke( object.Ptr() );
+
+		StrongPtr< Object > other = new TestObject ();
+		void* instances[] = { object.Ptr(), other.Ptr(), object.Ptr() };
+		ArgumentFrame frame ( *method );
+		method->Invoke( instances, HELIUM_ARRAY_COUNT( instances ), frame );
+		frame.Reset();
+		method->Invoke( other.Ptr(), frame );
+	}
+
+	{
+		const Reflect::Method* method = object->GetMetaClass()->FindMethodByName( Crc32( "Test Function" ) );
+
+		DynamicArray< StrongPtr< Object > > objects;
+		DynamicArray< Object* > range;
+		for ( uint32_t i=0; i<100; ++i )
+		{
+			objects.Add( new TestObject () );
+			range.Add( objects.GetLast().Ptr() );
+		}
+
+		DynamicArray< MethodError > errors;
+		ArgumentFrame argument ( *method );
+		InvokeParallel( *method, range.GetData(), range.GetSize(), 4, &argument, DispatchFlags::ResetArgument, &errors );
+		HELIUM_ASSERT( errors.IsEmpty() );
+
+		// every call that throws is reported, in object order
+		const Reflect::Method* throwing = object->GetMetaClass()->FindMethodByName( Crc32( "Throwing Function" ) );
+		HELIUM_ASSERT( throwing );
+		for ( uint32_t i=0; i<objects.GetSize(); ++i )
+		{
+			static_cast< TestObject* >( objects[ i ].Ptr() )->m_Struct.m_Uint32 = i;
+		}
+		InvokeParallel( *throwing, range.GetData(), range.GetSize(), 4, NULL, 0, &errors );
+		HELIUM_ASSERT( errors.GetSize() == ( objects.GetSize() + 6 ) / 7 );
+		for ( size_t i=0; i<errors.GetSize(); ++i )
+		{
+			HELIUM_ASSERT( errors[ i ].m_Index == i * 7 );
+			HELIUM_ASSERT( ( errors[ i ].m_Message == String( TXT( "Unknown exception" ) ) ) == ( i % 2 == 1 ) );
+		}
+	}
+
+	{
+		// an exception stops a parallel range and reaches the caller, whatever its type
+		int context = 0;
+		for ( uint32_t i=0; i<2; ++i )
+		{
+			g_RangeCount = 0;
+			String message;
+			try
+			{
+				ForEachParallel( 100000, 4, &ThrowInRange, i ? NULL : &context );
+			}
+			catch ( const Reflect::Exception& ex )
+			{
+				message = ex.What();
+			}
+			HELIUM_ASSERT( message == String( i ? TXT( "Unknown exception" ) : TXT( "Index 500" ) ) );
+			HELIUM_ASSERT( g_RangeCount < 100000 );
+		}
+
+		// the pool threads are kept for the next dispatch, and are started again once released
+		for ( uint32_t i=0; i<2; ++i )
+		{
+			g_RangeCount = 0;
+			ForEachParallel( 500, 4, &ThrowInRange, &context );
+			HELIUM_ASSERT( g_RangeCount == 500 );
+			ReleaseDispatchThreads();
+		}
+	}
+
+	{
+		ObjectSlab& slab = TestPooledObject::s_ObjectSlab;
+		HELIUM_ASSERT( slab.m_Size == GetMetaClass< TestPooledObject >()->m_Size );
+		HELIUM_ASSERT( slab.GetSlotSize() && slab.GetSlotSize() % slab.m_Alignment == 0 );
+
+		int32_t live = slab.GetLiveCount();
+		DynamicArray< StrongPtr< TestPooledObject > > objects;
+		for ( uint32_t i=0; i<100; ++i )
+		{
+			objects.Add( new TestPooledObject () );
+			objects.GetLast()->m_Value = i;
+		}
+		HELIUM_ASSERT( slab.GetLiveCount() == live + 100 );
+
+		StrongPtr< Object > clone = objects.GetLast()->Clone();
+		HELIUM_ASSERT( clone->Equals( objects.GetLast().Ptr() ) );
+
+		clone.Release();
+		objects.Clear();
+		HELIUM_ASSERT( slab.GetLiveCount() == live );
+
+		ObjectSlab::ReportStatistics();
+	}
+
+	{
+		StrongPtr< TestPooledObject > external = new TestPooledObject ();
+		HELIUM_ASSERT( !ObjectArena::Contains( external.Ptr() ) );
+
+		ObjectArena arena;
+		{
+			ObjectArenaScope scope ( arena );
+
+			// a cycle reference counting alone never frees
+			StrongPtr< TestPooledObject > first = new TestPooledObject ();
+			first->m_Next = new TestPooledObject ();
+			first->m_Next->m_Next = first;
+			first->m_Value = 1;
+			HELIUM_ASSERT( ObjectArena::Contains( first.Ptr() ) && ObjectArena::Contains( first->m_Next.Ptr() ) );
+
+			// never referenced at all
+			TestPooledObject* holder = new TestPooledObject ();
+			holder->m_Next = external;
+
+			// dies before the arena, destructed in place
+			StrongPtr< Object > temporary = new TestObject ();
+			temporary.Release();
+		}
+		HELIUM_ASSERT( arena.GetLiveCount() == 3 && arena.GetReservedBytes() );
+		HELIUM_ASSERT( external.GetProxy()->GetStrongRefCount() == 2 );
+
+		arena.Release();
+		HELIUM_ASSERT( arena.GetLiveCount() == 0 && arena.GetReservedBytes() == 0 );
+		HELIUM_ASSERT( external.GetProxy()->GetStrongRefCount() == 1 );
+	}
+
+	{
+		// the proxy is allocated right in front of the object
+		StrongPtr< TestInlineObject > object = new TestInlineObject ();
+		const char* proxy = reinterpret_cast< const char* >( object.GetProxy() );
+		const char* memory = reinterpret_cast< const char* >( object.Ptr() );
+		HELIUM_ASSERT( proxy < memory && memory - proxy <= HELIUM_SIMD_ALIGNMENT * 2 );
+
+		ObjectPtr copy = object;
+		HELIUM_ASSERT( object.GetProxy()->GetStrongRefCount() == 2 );
+		copy.Release();
+		HELIUM_ASSERT( object.GetProxy()->GetStrongRefCount() == 1 );
+
+		StrongPtr< Object > clone = object->Clone();
+		HELIUM_ASSERT( clone->IsA( GetMetaClass< TestInlineObject >() ) && clone->Equals( object.Ptr() ) );
+
+		// swapping with a pooled proxy keeps each memory until both its object and its proxy are gone
+		ObjectPtr inlined = new TestInlineObject ();
+		ObjectPtr pooled = new TestPooledObject ();
+		RefCountProxy< Object >* inlineProxy = inlined.GetProxy();
+		inlined->RefCountSwapProxies( pooled.Ptr() );
+		HELIUM_ASSERT( inlined.GetProxy() == inlineProxy );
+		HELIUM_ASSERT( inlined->IsA( GetMetaClass< TestPooledObject >() ) && pooled->IsA( GetMetaClass< TestInlineObject >() ) );
+		inlined.Release();
+		pooled.Release();
+	}
+
+	{
+		// copyable classes clone with their copy constructor, the copy gets its own reference count
+		StrongPtr< TestCopyableObject > object = new TestCopyableObject ();
+		object->m_Value = 3;
+		object->m_Values.Add( 5 );
+		object->m_Values.Add( 7 );
+		HELIUM_ASSERT( GetMetaClass< TestCopyableObject >()->m_Copier && !GetMetaClass< TestObject >()->m_Copier );
+
+		StrongPtr< TestCopyableObject > clone = static_cast< TestCopyableObject* >( object->Clone().Ptr() );
+		HELIUM_ASSERT( clone != object && clone->Equals( object.Ptr() ) && clone->m_Values.GetData() != object->m_Values.GetData() );
+		HELIUM_ASSERT( clone.GetProxy() != object.GetProxy() && clone.GetProxy()->GetStrongRefCount() == 1 );
+	}
+
+	{
+		// sample every object (the thread's first countdown is only drawn)
+		ObjectSampler::SetInterval( 1 );
+		ObjectPtr first = new TestObject ();
+
+		// objects made by their class's creator are filed under it, ones made with new directly aren't
+		DynamicArray< ObjectPtr > objects;
+		for ( uint32_t i=0; i<10; ++i )
+		{
+			objects.Add( GetMetaClass< TestPooledObject >()->m_Creator() );
+		}
+		ObjectPtr unfiled = new TestPooledObject ();
+		ObjectSampler::SetInterval( 0 );
+
+		DynamicArray< ObjectSampleCount > counts;
+		ObjectSampler::GetLiveCounts( counts );
+		HELIUM_ASSERT( counts.GetSize() && counts[ 0 ].m_Class == GetMetaClass< TestPooledObject >() );
+		HELIUM_ASSERT( counts[ 0 ].m_Samples == 10 && counts[ 0 ].m_Estimate == 10 );
+		bool foundUnfiled = false;
+		for ( size_t i=0; i<counts.GetSize(); ++i )
+		{
+			foundUnfiled |= counts[ i ].m_Class == NULL && counts[ i ].m_Samples >= 1;
+		}
+		HELIUM_ASSERT( foundUnfiled );
+		ObjectSampler::Report();
+
+		objects.Clear();
+		ObjectSampler::GetLiveCounts( counts );
+		for ( size_t i=0; i<counts.GetSize(); ++i )
+		{
+			HELIUM_ASSERT( counts[ i ].m_Class != GetMetaClass< TestPooledObject >() );
+		}
+	}
+
+	{
+		// a leaf shared three ways, and a cycle
+		StrongPtr< TestGraphObject > root = new TestGraphObject ();
+		StrongPtr< TestGraphObject > shared = new TestGraphObject ();
+		shared->m_Value = 7;
+		root->m_Left = shared;
+		root->m_Right = new TestGraphObject ();
+		root->m_Right->m_Left = shared;
+		root->m_Children.Add( shared );
+		root->m_Right->m_Right = root;
+
+		ObjectCloneMap clones;
+		StrongPtr< TestGraphObject > clone = static_cast< TestGraphObject* >( clones.Clone( root ).Ptr() );
+		HELIUM_ASSERT( clones.GetSize() == 3 && clones.Find( root ) == clone.Ptr() );
+		HELIUM_ASSERT( clone->m_Left != shared && clone->m_Left->m_Value == 7 );
+		HELIUM_ASSERT( clone->m_Left == clone->m_Right->m_Left && clone->m_Left == clone->m_Children[ 0 ] );
+		HELIUM_ASSERT( clone->m_Right->m_Right == clone );
+
+		// plain cloning copies the shared leaf every time it's reached
+		StrongPtr< TestGraphObject > tree = new TestGraphObject ();
+		tree->m_Left = shared;
+		tree->m_Right = shared;
+		StrongPtr< TestGraphObject > treeClone = static_cast< TestGraphObject* >( tree->Clone().Ptr() );
+		HELIUM_ASSERT( treeClone->m_Left != treeClone->m_Right );
+		treeClone = static_cast< TestGraphObject* >( tree->CloneGraph().Ptr() );
+		HELIUM_ASSERT( treeClone->m_Left == treeClone->m_Right && treeClone->m_Left != shared );
+
+		// the same graph copied by several threads
+		ObjectCloneMap parallelClones;
+		StrongPtr< TestGraphObject > parallelClone = static_cast< TestGraphObject* >( parallelClones.CloneParallel( root, 4 ).Ptr() );
+		HELIUM_ASSERT( parallelClones.GetSize() == 3 && parallelClones.Find( root ) == parallelClone.Ptr() );
+		HELIUM_ASSERT( parallelClone->m_Left == parallelClone->m_Right->m_Left && parallelClone->m_Left == parallelClone->m_Children[ 0 ] );
+		HELIUM_ASSERT( parallelClone->m_Right->m_Right == parallelClone && parallelClone->m_Left->m_Value == 7 );
+
+		// the leaf of an unfrozen tree can change underneath a clone, so its copy-on-write clone is a deep copy right away
+		StrongPtr< TestGraphObject > snapshot = static_cast< TestGraphObject* >( tree->CloneOnWrite().Ptr() );
+		HELIUM_ASSERT( !snapshot->IsCopyOnWrite() && snapshot->m_Left != shared && snapshot->m_Left == snapshot->m_Right );
+		shared->ChangeField( &TestGraphObject::m_Value, 8u );
+		HELIUM_ASSERT( snapshot->m_Left->m_Value == 7 );
+		shared->ChangeField( &TestGraphObject::m_Value, 7u );
+
+		// a frozen tree's clone shares the leaf until it's changed, and changes to the leaf from either side are refused meanwhile
+		tree->Freeze();
+		HELIUM_ASSERT( tree->IsFrozen() && shared->IsFrozen() );
+		snapshot = static_cast< TestGraphObject* >( tree->CloneOnWrite().Ptr() );
+		HELIUM_ASSERT( snapshot->IsCopyOnWrite() && !snapshot->IsFrozen() && snapshot->m_Left == shared && snapshot->m_Right == shared );
+		shared->ChangeField( &TestGraphObject::m_Value, 8u );
+		snapshot->m_Left->ChangeField( &TestGraphObject::m_Value, 9u );
+		HELIUM_ASSERT( shared->m_Value == 7 && snapshot->IsCopyOnWrite() );
+		snapshot->ChangeField( &TestGraphObject::m_Value, 3u );
+		HELIUM_ASSERT( !snapshot->IsCopyOnWrite() && snapshot->m_Value == 3 && tree->m_Value == 0 );
+		HELIUM_ASSERT( snapshot->m_Left != shared && snapshot->m_Left == snapshot->m_Right && snapshot->m_Left->m_Value == 7 );
+		snapshot->m_Left->ChangeField( &TestGraphObject::m_Value, 9u );
+		HELIUM_ASSERT( snapshot->m_Right->m_Value == 9 && shared->m_Value == 7 );
+		snapshot = static_cast< TestGraphObject* >( tree->CloneOnWrite().Ptr() );
+		snapshot->m_Value = 5;
+		snapshot->FieldChanged( &snapshot->m_Value );
+		HELIUM_ASSERT( !snapshot->IsCopyOnWrite() && snapshot->m_Value == 5 && snapshot->m_Left != shared );
+
+		// once its snapshots are materialized the tree can be thawed and changed again
+		tree->Thaw();
+		HELIUM_ASSERT( !tree->IsFrozen() && !shared->IsFrozen() );
+		shared->ChangeField( &TestGraphObject::m_Value, 8u );
+		HELIUM_ASSERT( shared->m_Value == 8 && snapshot->m_Left->m_Value == 7 );
+
+		// break the cycles so they can be freed
+		clones.Clear();
+		parallelClones.Clear();
+		clone->m_Right->m_Right = NULL;
+		parallelClone->m_Right->m_Right = NULL;
+		root->m_Right->m_Right = NULL;
+	}
+
+	{
+		const Field* valueField = GetMetaClass< TestGraphObject >()->FindField( &TestGraphObject::m_Value );
+		const Field* leftField = GetMetaClass< TestGraphObject >()->FindField( &TestGraphObject::m_Left );
+
+		StrongPtr< TestGraphObject > object = new TestGraphObject ();
+		StrongPtr< TestGraphObject > other = new TestGraphObject ();
+		object->AddChangedListener( ObjectChangeSignature::Delegate( &CountChange ) );
+		other->AddChangedListener( ObjectChangeSignature::Delegate( &CountChange ) );
+
+		// changes outside a transaction are raised right away
+		g_ChangeCount = 0;
+		object->ChangeField( &TestGraphObject::m_Value, 1u );
+		HELIUM_ASSERT( g_ChangeCount == 1 && g_ChangeField == valueField && !g_ChangeCoalesced );
+
+		// one notification per object, listing every field changed
+		g_ChangeCount = 0;
+		{
+			ObjectChangeTransaction transaction;
+			for ( uint32_t i=0; i<100; ++i )
+			{
+				object->ChangeField( &TestGraphObject::m_Value, i );
+			}
+			{
+				ObjectChangeTransaction nested;
+				object->ChangeField( &TestGraphObject::m_Left, other );
+			}
+			HELIUM_ASSERT( g_ChangeCount == 0 && transaction.GetSize() == 1 );
+		}
+		HELIUM_ASSERT( g_ChangeCount == 1 && g_ChangeField == NULL && g_ChangeCoalesced );
+		HELIUM_ASSERT( g_ChangeFields.Test( valueField->m_Index ) && g_ChangeFields.Test( leftField->m_Index ) );
+
+		// a single field changed is named, a change without a field stays ambiguous
+		g_ChangeCount = 0;
+		{
+			ObjectChangeTransaction transaction;
+			object->ChangeField( &TestGraphObject::m_Value, 2u );
+			object->ChangeField( &TestGraphObject::m_Value, 3u );
+			other->RaiseChanged();
+			other->FieldChanged( &other->m_Value );
+		}
+		HELIUM_ASSERT( g_ChangeCount == 2 && g_ChangeField == NULL && !g_ChangeCoalesced );
+
+		g_ChangeCount = 0;
+		{
+			ObjectChangeTransaction transaction;
+			object->ChangeField( &TestGraphObject::m_Value, 4u );
+		}
+		HELIUM_ASSERT( g_ChangeCount == 1 && g_ChangeField == valueField && g_ChangeCoalesced && !g_ChangeFields.Test( leftField->m_Index ) );
+
+		// a transaction neither keeps the objects it saw alive, nor takes ownership of those no one references yet
+		g_ChangeCount = 0;
+		{
+			ObjectChangeTransaction transaction;
+			TestGraphObject* unowned = new TestGraphObject ();
+			unowned->AddChangedListener( ObjectChangeSignature::Delegate( &CountChange ) );
+			unowned->ChangeField( &TestGraphObject::m_Value, 1u );
+			HELIUM_ASSERT( g_ChangeCount == 1 && transaction.GetSize() == 0 );
+
+			StrongPtr< TestGraphObject > owned = unowned;
+			owned->ChangeField( &TestGraphObject::m_Value, 2u );
+			size_t listened = ObjectChangeListeners::GetCount();
+			owned.Release();
+			HELIUM_ASSERT( ObjectChangeListeners::GetCount() == listened - 1 && transaction.GetSize() == 1 );
+		}
+		HELIUM_ASSERT( g_ChangeCount == 1 );
+
+		// listeners are kept outside the objects, until the objects are gone
+		size_t listened = ObjectChangeListeners::GetCount();
+		object->RemoveChangedListener( ObjectChangeSignature::Delegate( &CountChange ) );
+		g_ChangeCount = 0;
+		object->ChangeField( &TestGraphObject::m_Value, 5u );
+		other->ChangeField( &TestGraphObject::m_Value, 5u );
+		HELIUM_ASSERT( g_ChangeCount == 1 && ObjectChangeListeners::GetCount() == listened );
+		object->m_Left = NULL;
+		other.Release();
+		HELIUM_ASSERT( ObjectChangeListeners::GetCount() == listened - 1 );
+
+		// flags set from several threads at once are all kept, so every listened object's listeners go with it
+		listened = ObjectChangeListeners::GetCount();
+		DynamicArray< StrongPtr< TestGraphObject > > objects;
+		for ( uint32_t i=0; i<1000; ++i )
+		{
+			objects.Add( new TestGraphObject () );
+		}
+		ForEachParallel( objects.GetSize() * 4, 4, &FlagObjectsInRange, &objects );
+		HELIUM_ASSERT( ObjectChangeListeners::GetCount() == listened + objects.GetSize() );
+		for ( size_t i=0; i<objects.GetSize(); ++i )
+		{
+			HELIUM_ASSERT( objects[ i ]->IsTrackingDirtyFields() );
+		}
+		objects.Clear();
+		HELIUM_ASSERT( ObjectChangeListeners::GetCount() == listened );
+	}
+
+	{
+		const Field* valueField = GetMetaClass< TestGraphObject >()->FindField( &TestGraphObject::m_Value );
+		const Field* leftField = GetMetaClass< TestGraphObject >()->FindField( &TestGraphObject::m_Left );
+		const Field* childrenField = GetMetaClass< TestGraphObject >()->FindField( &TestGraphObject::m_Children );
+		HELIUM_ASSERT( valueField->m_Index != leftField->m_Index && GetMetaClass< TestGraphObject >()->FindFieldByIndex( childrenField->m_Index ) == childrenField );
+
+		// fields changed through the notification APIs are dirty until cleared
+		StrongPtr< TestGraphObject > object = new TestGraphObject ();
+		FieldBitSet dirty;
+		object->ChangeField( &TestGraphObject::m_Value, 1u );
+		HELIUM_ASSERT( !object->IsTrackingDirtyFields() && !object->GetDirtyFields( dirty ) );
+
+		object->TrackDirtyFields();
+		HELIUM_ASSERT( object->IsTrackingDirtyFields() && !object->GetDirtyFields( dirty ) );
+		object->ChangeField( &TestGraphObject::m_Value, 2u );
+		HELIUM_ASSERT( object->IsFieldDirty( valueField ) && !object->IsFieldDirty( leftField ) );
+
+		// a translator write that raises the change, inside a transaction too
+		{
+			ObjectChangeTransaction transaction;
+			StrongPtr< TestGraphObject > source = new TestGraphObject ();
+			source->m_Left = source;
+			leftField->m_Translator->Copy( Pointer( leftField, source.Ptr(), source.Ptr() ), Pointer( leftField, object.Ptr(), object.Ptr() ), CopyFlags::Notify | CopyFlags::Shallow );
+			source->m_Left = NULL;
+		}
+		HELIUM_ASSERT( object->GetDirtyFields( dirty ) && dirty.Test( valueField->m_Index ) && dirty.Test( leftField->m_Index ) && !dirty.Test( childrenField->m_Index ) );
+
+		object->ClearDirtyFields();
+		HELIUM_ASSERT( !object->GetDirtyFields( dirty ) );
+		object->RaiseChanged();
+		HELIUM_ASSERT( object->IsFieldDirty( valueField ) && object->IsFieldDirty( childrenField ) );
+
+		object->TrackDirtyFields( false );
+		HELIUM_ASSERT( !object->IsFieldDirty( valueField ) );
+		object->TrackDirtyFields();
+	}
+}
+
+// the benchmarks below report their times in microseconds
+static float64_t GetMicrosecondsSince( uint64_t start )
+{
+	return ( Timer::GetTickCount() - start ) * Timer::GetSecondsPerTick() * 1000000.0;
+}
+
+// enum lookups by value and by name scanning the elements, the way lookups worked before tables
+static void BenchmarkMetaEnumScan( const MetaEnum* enumeration, uint32_t iterations, float64_t& valueTime, float64_t& nameTime )
+{
+	uint32_t count = static_cast< uint32_t >( enumeration->m_Elements.GetSize() );
+	size_t found = 0;
+
+	uint64_t start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<iterations; ++i )
+	{
+		uint64_t value = enumeration->m_Elements[ i % count ].m_Value;
+		for ( uint32_t j=0; j<count; ++j )
+		{
+			if ( enumeration->m_Elements[ j ].m_Value == value )
+			{
+				found += enumeration->m_Elements[ j ].m_Name.length();
+				break;
+			}
+		}
+	}
+	valueTime = GetMicrosecondsSince( start );
+
+	start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<iterations; ++i )
+	{
+		const std::string& name = enumeration->m_Elements[ i % count ].m_Name;
+		for ( uint32_t j=0; j<count; ++j )
+		{
+			if ( enumeration->m_Elements[ j ].m_Name == name )
+			{
+				found += j;
+				break;
+			}
+		}
+	}
+	nameTime = GetMicrosecondsSince( start );
+
+	HELIUM_ASSERT( found );
+}
+
+// enum lookups by value and by name
+static void BenchmarkMetaEnum( const MetaEnum* enumeration, uint32_t iterations, float64_t& valueTime, float64_t& nameTime )
+{
+	uint32_t count = static_cast< uint32_t >( enumeration->m_Elements.GetSize() );
+	std::string str;
+	uint32_t value = 0;
+
+	uint64_t start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<iterations; ++i )
+	{
+		str.clear();
+		HELIUM_VERIFY( enumeration->GetString( enumeration->m_Elements[ i % count ].m_Value, str ) );
+	}
+	valueTime = GetMicrosecondsSince( start );
+
+	start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<iterations; ++i )
+	{
+		HELIUM_VERIFY( enumeration->GetValue( enumeration->m_Elements[ i % count ].m_Name, value ) );
+	}
+	nameTime = GetMicrosecondsSince( start );
+}
+
+// allocate then free a batch of objects, through the slab of a pooled class and through the heap
+static void BenchmarkObjectSlab( uint32_t iterations, float64_t& slabTime, float64_t& heapTime )
+{
+	const uint32_t batchSize = 256;
+	void* memory[ batchSize ];
+
+	ObjectSlab& slab = TestPooledObject::s_ObjectSlab;
+	uint64_t start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<iterations; i+=batchSize )
+	{
+		for ( uint32_t j=0; j<batchSize; ++j )
+		{
+			memory[ j ] = slab.Allocate();
+		}
+		for ( uint32_t j=0; j<batchSize; ++j )
+		{
+			slab.Free( memory[ j ] );
+		}
+	}
+	slabTime = GetMicrosecondsSince( start );
+
+	DefaultAllocator allocator;
+	start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<iterations; i+=batchSize )
+	{
+		for ( uint32_t j=0; j<batchSize; ++j )
+		{
+			memory[ j ] = allocator.AllocateAligned( HELIUM_SIMD_ALIGNMENT, slab.m_Size );
+		}
+		for ( uint32_t j=0; j<batchSize; ++j )
+		{
+			allocator.FreeAligned( memory[ j ] );
+		}
+	}
+	heapTime = GetMicrosecondsSince( start );
+}
+
+// create objects of a class that isn't pooled then destroy them, one object at a time from the heap and in an arena
+static void BenchmarkObjectArena( uint32_t count, float64_t& heapTime, float64_t& arenaTime )
+{
+	uint64_t start = Timer::GetTickCount();
+	{
+		DynamicArray< StrongPtr< TestGraphObject > > objects;
+		objects.Reserve( count );
+		for ( uint32_t i=0; i<count; ++i )
+		{
+			objects.Add( new TestGraphObject () );
+		}
+	}
+	heapTime = GetMicrosecondsSince( start );
+
+	start = Timer::GetTickCount();
+	{
+		ObjectArena arena;
+		{
+			ObjectArenaScope scope ( arena );
+			for ( uint32_t i=0; i<count; ++i )
+			{
+				new TestGraphObject ();
+			}
+		}
+		arena.Release();
+	}
+	arenaTime = GetMicrosecondsSince( start );
+}
+
+// create and destroy objects, then copy strong pointers to them around
+template< class T >
+static void BenchmarkStrongPtrChurn( uint32_t iterations, float64_t& createTime, float64_t& copyTime )
+{
+	const uint32_t objectCount = 4096;
+	DynamicArray< StrongPtr< T > > objects;
+	objects.Reserve( objectCount );
+
+	uint64_t start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<iterations; i+=objectCount )
+	{
+		objects.Clear();
+		for ( uint32_t j=0; j<objectCount; ++j )
+		{
+			objects.Add( new T () );
+		}
+	}
+	createTime = GetMicrosecondsSince( start );
+
+	DynamicArray< StrongPtr< T > > references;
+	references.Resize( objectCount );
+
+	start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<iterations; ++i )
+	{
+		references[ ( i * 7919 ) % objectCount ] = objects[ i % objectCount ];
+	}
+	copyTime = GetMicrosecondsSince( start );
+}
+
+// clone objects with their copy constructor and with reflection
+static void BenchmarkCloneCopyable( uint32_t iterations, float64_t& copierTime, float64_t& reflectedTime )
+{
+	StrongPtr< TestCopyableObject > object = new TestCopyableObject ();
+	for ( uint32_t i=0; i<16; ++i )
+	{
+		object->m_Values.Add( i );
+	}
+
+	uint64_t start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<iterations; ++i )
+	{
+		ObjectPtr clone = object->Clone();
+	}
+	copierTime = GetMicrosecondsSince( start );
+
+	start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<iterations; ++i )
+	{
+		ObjectPtr clone = GetMetaClass< TestCopyableObject >()->m_Creator();
+		object->CopyTo( clone );
+	}
+	reflectedTime = GetMicrosecondsSince( start );
+}
+
+// clone a wide graph whose nodes all reference a few shared leaves, tree by tree and as a graph
+static void BenchmarkCloneGraph( uint32_t nodeCount, uint32_t leafCount, float64_t& treeTime, float64_t& graphTime, size_t& treeObjects, size_t& graphObjects )
+{
+	DynamicArray< StrongPtr< TestGraphObject > > leaves;
+	for ( uint32_t i=0; i<leafCount; ++i )
+	{
+		leaves.Add( new TestGraphObject () );
+		leaves.GetLast()->m_Value = i;
+	}
+
+	StrongPtr< TestGraphObject > root = new TestGraphObject ();
+	for ( uint32_t i=0; i<nodeCount; ++i )
+	{
+		StrongPtr< TestGraphObject > node = new TestGraphObject ();
+		node->m_Left = leaves[ ( i * 7 ) % leafCount ];
+		node->m_Right = leaves[ ( i * 13 + 1 ) % leafCount ];
+		root->m_Children.Add( node );
+	}
+
+	uint64_t start = Timer::GetTickCount();
+	{
+		ObjectPtr clone = root->Clone();
+	}
+	treeTime = GetMicrosecondsSince( start );
+	treeObjects = 1 + nodeCount * 3;
+
+	start = Timer::GetTickCount();
+	{
+		ObjectCloneMap clones;
+		ObjectPtr clone = clones.Clone( root );
+		graphObjects = clones.GetSize();
+	}
+	graphTime = GetMicrosecondsSince( start );
+}
+
+// change fields of an object without listeners, and with one (one notification each and coalesced by a transaction)
+static void BenchmarkChangeTransaction( uint32_t changes, float64_t& unlistenedTime, float64_t& immediateTime, float64_t& transactionTime )
+{
+	StrongPtr< TestGraphObject > object = new TestGraphObject ();
+	object->AddChangedListener( ObjectChangeSignature::Delegate( &CountChange ) );
+
+	// nobody listening
+	StrongPtr< TestGraphObject > unlistened = new TestGraphObject ();
+	uint64_t start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<changes; ++i )
+	{
+		unlistened->ChangeField( &TestGraphObject::m_Value, i );
+	}
+	unlistenedTime = GetMicrosecondsSince( start );
+
+	start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<changes; ++i )
+	{
+		object->ChangeField( &TestGraphObject::m_Value, i );
+	}
+	immediateTime = GetMicrosecondsSince( start );
+
+	start = Timer::GetTickCount();
+	{
+		ObjectChangeTransaction transaction;
+		for ( uint32_t i=0; i<changes; ++i )
+		{
+			object->ChangeField( &TestGraphObject::m_Value, i );
+		}
+	}
+	transactionTime = GetMicrosecondsSince( start );
+}
+
+// find the objects changed since a save by comparing with snapshots and from dirty fields
+static void BenchmarkDirtyFields( uint32_t objectCount, uint32_t changeInterval, float64_t& equalsTime, float64_t& dirtyTime )
+{
+	DynamicArray< StrongPtr< TestGraphObject > > objects;
+	DynamicArray< ObjectPtr > snapshots;
+	for ( uint32_t i=0; i<objectCount; ++i )
+	{
+		objects.Add( new TestGraphObject () );
+		objects.GetLast()->TrackDirtyFields();
+		snapshots.Add( objects.GetLast()->Clone() );
+	}
+
+	for ( uint32_t i=0; i<objectCount; i+=changeInterval )
+	{
+		objects[ i ]->ChangeField( &TestGraphObject::m_Value, i + 1 );
+	}
+
+	uint32_t changed = 0;
+	uint64_t start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<objectCount; ++i )
+	{
+		changed += objects[ i ]->Equals( snapshots[ i ] ) ? 0 : 1;
+	}
+	equalsTime = GetMicrosecondsSince( start );
+
+	FieldBitSet dirty;
+	start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<objectCount; ++i )
+	{
+		changed -= objects[ i ]->GetDirtyFields( dirty ) ? 1 : 0;
+	}
+	dirtyTime = GetMicrosecondsSince( start );
+	HELIUM_ASSERT( changed == 0 );
+}
+
+// snapshot a graph with plain and copy-on-write clones, only changing one in every changeInterval
+static void BenchmarkCloneOnWrite( uint32_t nodeCount, uint32_t snapshotCount, uint32_t changeInterval, float64_t& cloneTime, float64_t& cloneOnWriteTime )
+{
+	StrongPtr< TestGraphObject > root = new TestGraphObject ();
+	for ( uint32_t i=0; i<nodeCount; ++i )
+	{
+		root->m_Children.Add( new TestGraphObject () );
+	}
+	root->Freeze();
+
+	uint64_t start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<snapshotCount; ++i )
+	{
+		StrongPtr< TestGraphObject > snapshot = static_cast< TestGraphObject* >( root->Clone().Ptr() );
+		if ( i % changeInterval == 0 )
+		{
+			snapshot->ChangeField( &TestGraphObject::m_Value, i );
+		}
+	}
+	cloneTime = GetMicrosecondsSince( start );
+
+	start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<snapshotCount; ++i )
+	{
+		StrongPtr< TestGraphObject > snapshot = static_cast< TestGraphObject* >( root->CloneOnWrite().Ptr() );
+		if ( i % changeInterval == 0 )
+		{
+			snapshot->ChangeField( &TestGraphObject::m_Value, i );
+		}
+	}
+	cloneOnWriteTime = GetMicrosecondsSince( start );
+}
+
+// clone a graph of objects with a lot of data each, on threadCount threads
+static float64_t BenchmarkCloneParallel( uint32_t nodeCount, uint32_t threadCount )
+{
+	StrongPtr< TestGraphObject > root = new TestGraphObject ();
+	for ( uint32_t i=0; i<nodeCount; ++i )
+	{
+		StrongPtr< TestGraphObject > node = new TestGraphObject ();
+		node->m_Left = new TestGraphObject ();
+		for ( uint32_t j=0; j<16; ++j )
+		{
+			node->m_Children.Add( node->m_Left );
+		}
+		root->m_Children.Add( node );
+	}
+
+	uint64_t start = Timer::GetTickCount();
+	{
+		ObjectCloneMap clones;
+		ObjectPtr clone = clones.CloneParallel( root, threadCount );
+	}
+	return GetMicrosecondsSince( start );
+}
+
+// load structures field by field through temporaries, as archives do, allocating them from the heap and as variables
+static void BenchmarkArchiveLoad( uint32_t count, float64_t& heapTime, float64_t& variableTime, int32_t& variableAllocations )
+{
+	const MetaStruct* structure = GetMetaStruct< TestStructure >();
+	SmartPtr< Translator > structureTranslator = AllocateTranslator< TestStructure >();
+
+	TestStructure source;
+	source.m_StdVectorUint32.push_back( 1 );
+	source.m_FoundationDynamicArrayUint32.Add( 2 );
+	DynamicArray< TestStructure > destinations;
+	destinations.Resize( count );
+
+	uint64_t start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<count; ++i )
+	{
+		Pointer temporary ( new unsigned char[ structureTranslator->m_Size ] );
+		structureTranslator->Construct( temporary );
+		for ( size_t j=0; j<structure->m_Fields.GetSize(); ++j )
+		{
+			const Field& field = structure->m_Fields[ j ];
+			Pointer value ( new unsigned char[ field.m_Translator->m_Size ] );
+			field.m_Translator->Construct( value );
+			field.m_Translator->Copy( Pointer( &field, &source, NULL ), value );
+			field.m_Translator->Move( value, Pointer( &field, temporary.m_Address, NULL ) );
+			field.m_Translator->Destruct( value );
+			delete[] static_cast< unsigned char* >( value.m_Address );
+		}
+		structureTranslator->Move( temporary, Pointer( &destinations[ i ] ) );
+		structureTranslator->Destruct( temporary );
+		delete[] static_cast< unsigned char* >( temporary.m_Address );
+	}
+	heapTime = GetMicrosecondsSince( start );
+
+	int32_t heapAllocations = Variable::GetHeapAllocationCount();
+	start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<count; ++i )
+	{
+		Variable temporary ( structureTranslator.Ptr() );
+		for ( size_t j=0; j<structure->m_Fields.GetSize(); ++j )
+		{
+			const Field& field = structure->m_Fields[ j ];
+			Variable value ( field.m_Translator.Ptr() );
+			field.m_Translator->Copy( Pointer( &field, &source, NULL ), value );
+			field.m_Translator->Move( value, Pointer( &field, temporary.m_Address, NULL ) );
+		}
+		structureTranslator->Move( temporary, Pointer( &destinations[ i ] ) );
+	}
+	variableTime = GetMicrosecondsSince( start );
+	variableAllocations = Variable::GetHeapAllocationCount() - heapAllocations;
+}
+
+// create and destroy objects with the given sampling interval
+static float64_t BenchmarkObjectSampling( uint32_t interval, uint32_t iterations )
+{
+	const uint32_t batchSize = 256;
+	ObjectPtr objects[ batchSize ];
+
+	ObjectSampler::SetInterval( interval );
+	uint64_t start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<iterations; i+=batchSize )
+	{
+		for ( uint32_t j=0; j<batchSize; ++j )
+		{
+			objects[ j ] = new TestPooledObject ();
+		}
+		for ( uint32_t j=0; j<batchSize; ++j )
+		{
+			objects[ j ].Release();
+		}
+	}
+	float64_t time = GetMicrosecondsSince( start );
+	ObjectSampler::SetInterval( 0 );
+
+	return time;
+}
+
+// allocate and release reference count proxies in batches, as many threads creating objects at once do
+static void BenchmarkProxyThread( void* param )
+{
+	const uint32_t batchSize = 256;
+	RefCountProxy< Object >* proxies[ batchSize ];
+
+	uint32_t iterations = *static_cast< uint32_t* >( param );
+	for ( uint32_t i=0; i<iterations; i+=batchSize )
+	{
+		for ( uint32_t j=0; j<batchSize; ++j )
+		{
+			proxies[ j ] = ObjectRefCountSupport::Allocate();
+		}
+		for ( uint32_t j=0; j<batchSize; ++j )
+		{
+			ObjectRefCountSupport::Release( proxies[ j ] );
+		}
+	}
+
+	ObjectRefCountSupport::ReleaseThreadCache();
+}
+
+// run the proxy benchmark on a number of threads at once
+static float64_t BenchmarkProxyContention( uint32_t threadCount, uint32_t iterations )
+{
+	DynamicArray< CallbackThread* > threads;
+	uint64_t start = Timer::GetTickCount();
+	for ( uint32_t i=0; i<threadCount; ++i )
+	{
+		threads.Add( new CallbackThread () );
+		HELIUM_VERIFY( threads.GetLast()->Create( &BenchmarkProxyThread, &iterations, TXT( "Proxy Benchmark" ) ) );
+	}
+	for ( uint32_t i=0; i<threadCount; ++i )
+	{
+		threads[ i ]->Join();
+		delete threads[ i ];
+	}
+	return GetMicrosecondsSince( start );
+}
+
+void Reflect::RunBenchmarks()
+{
+	const uint32_t elementCount = 512;
+	const uint32_t iterations = 100000;
+
+	for ( uint32_t sparse=0; sparse<2; ++sparse )
+	{
+		SmartPtr< MetaEnum > enumeration = new MetaEnum ();
+		for ( uint32_t i=0; i<elementCount; ++i )
+		{
+			std::ostringstream name;
+			name << "Element" << i;
+			enumeration->AddElement( sparse ? i * 7919 + 3 : i, name.str(), "" );
+		}
+
+		float64_t scanValue, scanName, tableValue, tableName;
+		BenchmarkMetaEnumScan( enumeration.Ptr(), iterations, scanValue, scanName );
+		BenchmarkMetaEnum( enumeration.Ptr(), iterations, tableValue, tableName );
+
+		Log::Print( TXT( "MetaEnum (%d %s elements, %d lookups): value->name %.0fus scanned, %.0fus tabled; name->value %.0fus scanned, %.0fus tabled\n" ),
+			elementCount, sparse ? TXT( "sparse" ) : TXT( "dense" ), iterations, scanValue, tableValue, scanName, tableName );
+	}
+
+	{
+		float64_t slabTime, heapTime;
+		BenchmarkObjectSlab( iterations, slabTime, heapTime );
+
+		Log::Print( TXT( "Object allocation (%d %d byte objects): %.0fus slab, %.0fus heap\n" ),
+			iterations, (int)TestPooledObject::s_ObjectSlab.m_Size, slabTime, heapTime );
+	}
+
+	{
+		float64_t heapTime, arenaTime;
+		BenchmarkObjectArena( iterations, heapTime, arenaTime );
+
+		Log::Print( TXT( "Object graph (%d objects): %.0fus from the heap, %.0fus in an arena\n" ),
+			iterations, heapTime, arenaTime );
+	}
+
+	{
+		float64_t pooledCreate, pooledCopy, inlineCreate, inlineCopy;
+		BenchmarkStrongPtrChurn< TestPooledObject >( iterations, pooledCreate, pooledCopy );
+		BenchmarkStrongPtrChurn< TestInlineObject >( iterations, inlineCreate, inlineCopy );
+
+		Log::Print( TXT( "Strong pointer churn (%d objects, %d copies): pooled proxies %.0fus/%.0fus, inline proxies %.0fus/%.0fus\n" ),
+			iterations, iterations, pooledCreate, pooledCopy, inlineCreate, inlineCopy );
+	}
+
+	{
+		float64_t copierTime, reflectedTime;
+		BenchmarkCloneCopyable( iterations, copierTime, reflectedTime );
+
+		Log::Print( TXT( "Clone (%d objects): %.0fus copy constructed, %.0fus copied by reflection\n" ), iterations, copierTime, reflectedTime );
+	}
+
+	{
+		float64_t treeTime, graphTime;
+		size_t treeObjects, graphObjects;
+		BenchmarkCloneGraph( 4096, 64, treeTime, graphTime, treeObjects, graphObjects );
+
+		Log::Print( TXT( "Clone (4096 nodes sharing 64 leaves): %.0fus for %d objects cloned as trees, %.0fus for %d cloned as a graph\n" ),
+			treeTime, (int)treeObjects, graphTime, (int)graphObjects );
+	}
+
+	{
+		float64_t unlistenedTime, immediateTime, transactionTime;
+		BenchmarkChangeTransaction( 10000, unlistenedTime, immediateTime, transactionTime );
+
+		Log::Print( TXT( "Change notifications (10000 changes, %d byte objects): %.0fus unlistened, %.0fus raised each, %.0fus coalesced by a transaction\n" ),
+			(int)sizeof( Object ), unlistenedTime, immediateTime, transactionTime );
+	}
+
+	{
+		float64_t equalsTime, dirtyTime;
+		BenchmarkDirtyFields( 10000, 16, equalsTime, dirtyTime );
+
+		Log::Print( TXT( "Changed objects (1 in 16 of 10000): %.0fus compared with snapshots, %.0fus from dirty fields\n" ), equalsTime, dirtyTime );
+	}
+
+	{
+		float64_t cloneTime, cloneOnWriteTime;
+		BenchmarkCloneOnWrite( 1024, 64, 8, cloneTime, cloneOnWriteTime );
+
+		Log::Print( TXT( "Snapshots (64 of 1024 nodes, 1 in 8 changed): %.0fus cloned, %.0fus copy-on-write\n" ), cloneTime, cloneOnWriteTime );
+	}
+
+	{
+		float64_t heapTime, variableTime;
+		int32_t variableAllocations;
+		BenchmarkArchiveLoad( 10000, heapTime, variableTime, variableAllocations );
+
+		Log::Print( TXT( "Archive load (10000 structures of %d fields): %.0fus with heap temporaries, %.0fus with variables making %d heap allocations\n" ),
+			(int)GetMetaStruct< TestStructure >()->m_Fields.GetSize(), heapTime, variableTime, variableAllocations );
+	}
+
+	{
+		float64_t single = BenchmarkCloneParallel( 4096, 1 );
+		float64_t parallel = BenchmarkCloneParallel( 4096, 4 );
+
+		Log::Print( TXT( "Clone in parallel (8193 objects): %.0fus on 1 thread, %.0fus on 4 threads\n" ), single, parallel );
+	}
+
+	{
+		float64_t unsampled = BenchmarkObjectSampling( 0, iterations );
+		float64_t sampled = BenchmarkObjectSampling( 1024, iterations );
+
+		Log::Print( TXT( "Object lifetime (%d objects): %.0fus unsampled, %.0fus sampling 1 in 1024\n" ),
+			iterations, unsampled, sampled );
+	}
+
+	{
+		float64_t single = BenchmarkProxyContention( 1, iterations );
+		float64_t contended = BenchmarkProxyContention( 16, iterations );
+
+		Log::Print( TXT( "Reference count proxies (%d per thread): %.0fus on 1 thread, %.0fus on 16 threads\n" ),
+			iterations, single, contended );
+	}
 }
 
 #endif
\ No newline at end of file
@@ -42,12 +42,61 @@ namespace Helium
 			Set<uint32_t> m_FoundationSetUint32;
 			Map<uint32_t, uint32_t> m_FoundationMapUint32;
 
+			std::unordered_set<uint32_t> m_StdUnorderedSetUint32;
+			std::unordered_map<uint32_t, uint32_t> m_StdUnorderedMapUint32;
+
+			HashSet<uint32_t> m_FoundationHashSetUint32;
+			HashMap<uint32_t, uint32_t> m_FoundationHashMapUint32;
+
 			TestStructure();
 
 			HELIUM_DECLARE_BASE_STRUCT( TestStructure );
 			static void PopulateMetaType( MetaStruct& comp );
 		};
 
+		struct HELIUM_REFLECT_API TestStaticStructure : Struct
+		{
+			uint32_t  m_Uint32;
+			int16_t   m_Int16;
+			float32_t m_Float32;
+			float64_t m_Float64Array[ 4 ];
+			uint32_t  m_Scratch;
+
+			TestStaticStructure();
+
+			template< class VisitorT >
+			static void VisitStaticFields( VisitorT& visitor )
+			{
+				visitor( &TestStaticStructure::m_Uint32,       "Unsigned 32-bit Integer" );
+				visitor( &TestStaticStructure::m_Int16,        "Signed 16-bit Integer" );
+				visitor( &TestStaticStructure::m_Float32,      "32-bit Floating Point" );
+				visitor( &TestStaticStructure::m_Float64Array, "64-bit Floating Point Array" );
+				visitor( &TestStaticStructure::m_Scratch,      "Scratch", FieldFlags::Discard );
+			}
+
+			HELIUM_DECLARE_BASE_STRUCT( TestStaticStructure );
+			static void PopulateMetaType( MetaStruct& comp );
+		};
+
+		// nests a structure with no operator==
+		struct HELIUM_REFLECT_API TestStaticNestingStructure : Struct
+		{
+			uint32_t            m_Count;
+			TestStaticStructure m_Nested;
+
+			TestStaticNestingStructure();
+
+			template< class VisitorT >
+			static void VisitStaticFields( VisitorT& visitor )
+			{
+				visitor( &TestStaticNestingStructure::m_Count,  "Count" );
+				visitor( &TestStaticNestingStructure::m_Nested, "Nested" );
+			}
+
+			HELIUM_DECLARE_BASE_STRUCT( TestStaticNestingStructure );
+			static void PopulateMetaType( MetaStruct& comp );
+		};
+
 		class HELIUM_REFLECT_API TestObject : public Object
 		{
 		public:
@@ -59,12 +108,63 @@ namespace Helium
 
 			TestObject();
 			void TestFunction( TestStructure& args );
+			void ThrowingFunction( TestStructure& args ); // throws for objects whose m_Struct.m_Uint32 is a multiple of 7
 
 			HELIUM_DECLARE_CLASS( TestObject, Object );
 			static void PopulateMetaType( MetaClass& comp );
 		};
 
+		class HELIUM_REFLECT_API TestPooledObject : public Object
+		{
+		public:
+			uint32_t                         m_Value;
+			StrongPtr< TestPooledObject >    m_Next;  // not reflected, links graphs for the arena tests
+
+			TestPooledObject();
+
+			HELIUM_DECLARE_POOLED_CLASS( TestPooledObject, Object );
+			static void PopulateMetaType( MetaClass& comp );
+		};
+
+		class HELIUM_REFLECT_API TestInlineObject : public Object
+		{
+		public:
+			uint32_t                         m_Value;
+
+			TestInlineObject();
+
+			HELIUM_DECLARE_INLINE_REF_COUNT_CLASS( TestInlineObject, Object );
+			static void PopulateMetaType( MetaClass& comp );
+		};
+
+		class HELIUM_REFLECT_API TestCopyableObject : public Object
+		{
+		public:
+			uint32_t                         m_Value;
+			DynamicArray< uint32_t >         m_Values;
+
+			TestCopyableObject();
+
+			HELIUM_DECLARE_COPYABLE_CLASS( TestCopyableObject, Object );
+			static void PopulateMetaType( MetaClass& comp );
+		};
+
+		class HELIUM_REFLECT_API TestGraphObject : public Object
+		{
+		public:
+			uint32_t                                     m_Value;
+			StrongPtr< TestGraphObject >                 m_Left;
+			StrongPtr< TestGraphObject >                 m_Right;
+			DynamicArray< StrongPtr< TestGraphObject > > m_Children;
+
+			TestGraphObject();
+
+			HELIUM_DECLARE_CLASS( TestGraphObject, Object );
+			static void PopulateMetaType( MetaClass& comp );
+		};
+
 		HELIUM_REFLECT_API void RunTests();
+		HELIUM_REFLECT_API void RunBenchmarks();
 	}
 }
 
@@ -36,6 +36,16 @@ void TypeTranslator::Copy( Pointer src, Pointer dest, uint32_t flags )
 	DefaultCopy< const MetaType* >( src, dest, flags );
 }
 
+void TypeTranslator::Move( Pointer src, Pointer dest )
+{
+	DefaultCopy< const MetaType* >( src, dest, 0 );
+}
+
+void TypeTranslator::Swap( Pointer a, Pointer b )
+{
+	DefaultSwap< const MetaType* >( a, b );
+}
+
 bool TypeTranslator::Equals( Pointer a, Pointer b )
 {
 	return DefaultEquals< const MetaType* >( a, b );
@@ -26,6 +26,8 @@ namespace Helium
 			virtual void Construct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Destruct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Copy( Pointer src, Pointer dest, uint32_t flags ) HELIUM_OVERRIDE;
+			virtual void Move( Pointer src, Pointer dest ) HELIUM_OVERRIDE;
+			virtual void Swap( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual bool Equals( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual void Print( Pointer pointer, String& string, ObjectIdentifier* identifier) HELIUM_OVERRIDE;
 			virtual void Parse( const String& string, Pointer pointer, ObjectResolver* resolver, bool raiseChanged ) HELIUM_OVERRIDE;
@@ -97,6 +99,8 @@ namespace Helium
 			virtual void Construct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Destruct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Copy( Pointer src, Pointer dest, uint32_t flags ) HELIUM_OVERRIDE;
+			virtual void Move( Pointer src, Pointer dest ) HELIUM_OVERRIDE;
+			virtual void Swap( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual bool Equals( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual const MetaStruct* GetMetaStruct() const HELIUM_OVERRIDE;
 		};
@@ -119,6 +123,9 @@ namespace Helium
 
 		//////////////////////////////////////////////////////////////////////////
 
+		// clone an object through the ObjectCloneMap cloning on the calling thread, false if there is none
+		HELIUM_REFLECT_API bool CloneThroughCurrentMap( Object* source, Object*& clone );
+
 		template< class T >
 		class PointerTranslator : public ScalarTranslator
 		{
@@ -130,6 +137,8 @@ namespace Helium
 			virtual void Construct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Destruct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Copy( Pointer src, Pointer dest, uint32_t flags ) HELIUM_OVERRIDE;
+			virtual void Move( Pointer src, Pointer dest ) HELIUM_OVERRIDE;
+			virtual void Swap( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual bool Equals( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual void Print( Pointer pointer, String& string, ObjectIdentifier* identifier) HELIUM_OVERRIDE;
 			virtual void Parse( const String& string, Pointer pointer, ObjectResolver* resolver, bool raiseChanged ) HELIUM_OVERRIDE;
@@ -166,6 +175,8 @@ namespace Helium
 			virtual void Construct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Destruct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Copy( Pointer src, Pointer dest, uint32_t flags ) HELIUM_OVERRIDE;
+			virtual void Move( Pointer src, Pointer dest ) HELIUM_OVERRIDE;
+			virtual void Swap( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual bool Equals( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual void Print( Pointer pointer, String& string, ObjectIdentifier* identifier) HELIUM_OVERRIDE;
 			virtual void Parse( const String& string, Pointer pointer, ObjectResolver* resolver, bool raiseChanged ) HELIUM_OVERRIDE;
@@ -198,6 +209,8 @@ namespace Helium
 			virtual void Construct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Destruct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Copy( Pointer src, Pointer dest, uint32_t flags ) HELIUM_OVERRIDE;
+			virtual void Move( Pointer src, Pointer dest ) HELIUM_OVERRIDE;
+			virtual void Swap( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual bool Equals( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual void Print( Pointer pointer, String& string, ObjectIdentifier* identifier) HELIUM_OVERRIDE;
 			virtual void Parse( const String& string, Pointer pointer, ObjectResolver* resolver, bool raiseChanged ) HELIUM_OVERRIDE;
@@ -21,6 +21,18 @@ void Helium::Reflect::SimpleScalarTranslator<T>::Copy( Pointer src, Pointer dest
 	DefaultCopy< T >( src, dest, flags );
 }
 
+template< class T >
+void Helium::Reflect::SimpleScalarTranslator<T>::Move( Pointer src, Pointer dest )
+{
+	DefaultCopy< T >( src, dest, 0 );
+}
+
+template< class T >
+void Helium::Reflect::SimpleScalarTranslator<T>::Swap( Pointer a, Pointer b )
+{
+	DefaultSwap< T >( a, b );
+}
+
 template< class T >
 bool Helium::Reflect::SimpleScalarTranslator<T>::Equals( Pointer a, Pointer b )
 {
@@ -113,6 +125,20 @@ void Helium::Reflect::SimpleStructureTranslator<T>::Copy( Pointer src, Pointer d
 	dest.RaiseChanged( flags & CopyFlags::Notify ); 
 }
 
+template< class T >
+void Helium::Reflect::SimpleStructureTranslator<T>::Move( Pointer src, Pointer dest )
+{
+	const MetaStruct* structure = Reflect::GetMetaStruct< T >();
+	structure->Move( src.m_Address, src.m_Object, dest.m_Address, dest.m_Object );
+}
+
+template< class T >
+void Helium::Reflect::SimpleStructureTranslator<T>::Swap( Pointer a, Pointer b )
+{
+	const MetaStruct* structure = Reflect::GetMetaStruct< T >();
+	structure->Swap( a.m_Address, a.m_Object, b.m_Address, b.m_Object );
+}
+
 template< class T >
 bool Helium::Reflect::SimpleStructureTranslator<T>::Equals( Pointer a, Pointer b )
 {
@@ -164,7 +190,13 @@ void Helium::Reflect::PointerTranslator<T>::Copy( Pointer src, Pointer dest, uin
 	{
 		StrongPtr< T >& srcPtr ( src.As< StrongPtr< T > >() );
 		StrongPtr< T >& destPtr ( dest.As< StrongPtr< T > >() );
-		if ( srcPtr.ReferencesObject() )
+		// cloning a graph, each object is cloned once
+		Object* clone = NULL;
+		if ( CloneThroughCurrentMap( const_cast< Object* >( static_cast< const Object* >( srcPtr.Ptr() ) ), clone ) )
+		{
+			destPtr = static_cast< T* >( clone );
+		}
+		else if ( srcPtr.ReferencesObject() )
 		{
 			destPtr = static_cast< T* >( srcPtr->Clone().Ptr() );
 		}
@@ -177,6 +209,24 @@ void Helium::Reflect::PointerTranslator<T>::Copy( Pointer src, Pointer dest, uin
 	dest.RaiseChanged( flags & CopyFlags::Notify ); 
 }
 
+template< class T >
+void Helium::Reflect::PointerTranslator<T>::Move( Pointer src, Pointer dest )
+{
+	if ( src.m_Address != dest.m_Address )
+	{
+		StrongPtr< T >& srcPtr ( src.As< StrongPtr< T > >() );
+		StrongPtr< T >& destPtr ( dest.As< StrongPtr< T > >() );
+		destPtr = srcPtr;
+		srcPtr.Release();
+	}
+}
+
+template< class T >
+void Helium::Reflect::PointerTranslator<T>::Swap( Pointer a, Pointer b )
+{
+	DefaultSwap< StrongPtr< T > >( a, b );
+}
+
 template< class T >
 bool Helium::Reflect::PointerTranslator<T>::Equals( Pointer a, Pointer b )
 {
@@ -235,6 +285,18 @@ void Helium::Reflect::EnumerationTranslator<T>::Copy( Pointer src, Pointer dest,
 	DefaultCopy<T>( src, dest, flags );
 }
 
+template< class T >
+void Helium::Reflect::EnumerationTranslator<T>::Move( Pointer src, Pointer dest )
+{
+	DefaultCopy<T>( src, dest, 0 );
+}
+
+template< class T >
+void Helium::Reflect::EnumerationTranslator<T>::Swap( Pointer a, Pointer b )
+{
+	DefaultSwap<T>( a, b );
+}
+
 template< class T >
 bool Helium::Reflect::EnumerationTranslator<T>::Equals( Pointer a, Pointer b )
 {
@@ -246,25 +308,34 @@ void Helium::Reflect::EnumerationTranslator<T>::Print( Pointer pointer, String&
 {
 	const MetaEnum* enumeration = GetMetaEnum< T >();
 
-	uint32_t value = 0;
-	value = static_cast< uint32_t >( pointer.As< T >() );
-	HELIUM_COMPILE_ASSERT( sizeof( typename T::Enum ) == sizeof( value ) );
+	uint64_t value = 0;
+	value = static_cast< uint64_t >( pointer.As< T >() );
+	HELIUM_COMPILE_ASSERT( sizeof( typename T::Enum ) <= sizeof( value ) );
 
-	std::string str;
-	enumeration->GetString( value, str );
-	string = str.c_str();
+	char buffer[ 256 ];
+	size_t length = 0;
+	enumeration->Format( value, buffer, sizeof( buffer ), length );
+	if ( length < sizeof( buffer ) )
+	{
+		string = buffer;
+	}
+	else
+	{
+		std::string str;
+		enumeration->GetString( value, str );
+		string = str.c_str();
+	}
 }
 
 template< class T >
 void Helium::Reflect::EnumerationTranslator<T>::Parse( const String& string, Pointer pointer, ObjectResolver* resolver, bool raiseChanged )
 {
 	const MetaEnum* enumeration = GetMetaEnum< T >();
-	std::string str = string.GetData();
 
-	uint32_t value = 0;
-	enumeration->GetValue( str, value );
+	uint64_t value = 0;
+	enumeration->Parse( string.GetData(), string.GetSize(), value );
 	pointer.As< T >() = static_cast< typename T::Enum >( value );
-	HELIUM_COMPILE_ASSERT( sizeof( typename T::Enum ) == sizeof( value ) );
+	HELIUM_COMPILE_ASSERT( sizeof( typename T::Enum ) <= sizeof( value ) );
 
 	pointer.RaiseChanged( raiseChanged ); 
 }
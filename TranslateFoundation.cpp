@@ -26,6 +26,16 @@ void StringTranslator::Copy( Pointer src, Pointer dest, uint32_t flags )
 	DefaultCopy< String >( src, dest, flags );
 }
 
+void StringTranslator::Move( Pointer src, Pointer dest )
+{
+	DefaultCopy< String >( src, dest, 0 );
+}
+
+void StringTranslator::Swap( Pointer a, Pointer b )
+{
+	DefaultSwap< String >( a, b );
+}
+
 bool StringTranslator::Equals( Pointer a, Pointer b )
 {
 	return DefaultEquals< String >( a, b );
@@ -61,6 +71,16 @@ void NameTranslator::Copy( Pointer src, Pointer dest, uint32_t flags )
 	DefaultCopy< Name >( src, dest, flags );
 }
 
+void NameTranslator::Move( Pointer src, Pointer dest )
+{
+	DefaultCopy< Name >( src, dest, 0 );
+}
+
+void NameTranslator::Swap( Pointer a, Pointer b )
+{
+	DefaultSwap< Name >( a, b );
+}
+
 bool NameTranslator::Equals( Pointer a, Pointer b )
 {
 	return DefaultEquals< Name >( a, b );
@@ -96,6 +116,16 @@ void FilePathTranslator::Copy( Pointer src, Pointer dest, uint32_t flags )
 	DefaultCopy< FilePath >( src, dest, flags );
 }
 
+void FilePathTranslator::Move( Pointer src, Pointer dest )
+{
+	DefaultCopy< FilePath >( src, dest, 0 );
+}
+
+void FilePathTranslator::Swap( Pointer a, Pointer b )
+{
+	DefaultSwap< FilePath >( a, b );
+}
+
 bool FilePathTranslator::Equals( Pointer a, Pointer b )
 {
 	return DefaultEquals< FilePath >( a, b );
@@ -4,6 +4,8 @@
 #include "Foundation/String.h"
 #include "Foundation/Name.h"
 #include "Foundation/Map.h"
+#include "Foundation/HashMap.h"
+#include "Foundation/HashSet.h"
 
 #include "Reflect/Translator.h"
 
@@ -18,6 +20,8 @@ namespace Helium
 			virtual void Construct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Destruct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Copy( Pointer src, Pointer dest, uint32_t flags ) HELIUM_OVERRIDE;
+			virtual void Move( Pointer src, Pointer dest ) HELIUM_OVERRIDE;
+			virtual void Swap( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual bool Equals( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual void Print( Pointer pointer, String& string, ObjectIdentifier* identifier ) HELIUM_OVERRIDE;
 			virtual void Parse( const String& string, Pointer pointer, ObjectResolver* resolver, bool raiseChanged ) HELIUM_OVERRIDE;
@@ -45,6 +49,8 @@ namespace Helium
 			virtual void Construct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Destruct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Copy( Pointer src, Pointer dest, uint32_t flags ) HELIUM_OVERRIDE;
+			virtual void Move( Pointer src, Pointer dest ) HELIUM_OVERRIDE;
+			virtual void Swap( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual bool Equals( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual void Print( Pointer pointer, String& string, ObjectIdentifier* identifier ) HELIUM_OVERRIDE;
 			virtual void Parse( const String& string, Pointer pointer, ObjectResolver* resolver, bool raiseChanged ) HELIUM_OVERRIDE;
@@ -72,6 +78,8 @@ namespace Helium
 			virtual void Construct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Destruct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void Copy( Pointer src, Pointer dest, uint32_t flags ) HELIUM_OVERRIDE;
+			virtual void Move( Pointer src, Pointer dest ) HELIUM_OVERRIDE;
+			virtual void Swap( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual bool Equals( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual void Print( Pointer pointer, String& string, ObjectIdentifier* identifier ) HELIUM_OVERRIDE;
 			virtual void Parse( const String& string, Pointer pointer, ObjectResolver* resolver, bool raiseChanged ) HELIUM_OVERRIDE;
@@ -103,11 +111,16 @@ namespace Helium
 			virtual void        Construct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void        Destruct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void        Copy( Pointer src, Pointer dest, uint32_t flags = 0 ) HELIUM_OVERRIDE;
+			virtual void        Move( Pointer src, Pointer dest ) HELIUM_OVERRIDE;
+			virtual void        Swap( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual bool        Equals( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 
 			// ContainerTranslator
 			virtual size_t      GetLength( Pointer container ) const HELIUM_OVERRIDE;
 			virtual void        Clear( Pointer container ) HELIUM_OVERRIDE;
+			virtual void        Reserve( Pointer container, size_t capacity ) HELIUM_OVERRIDE;
+			virtual bool        Begin( Pointer container, ContainerCursor& cursor ) const HELIUM_OVERRIDE;
+			virtual bool        Next( ContainerCursor& cursor ) const HELIUM_OVERRIDE;
 
 			// SequenceTranslator
 			virtual Translator* GetItemTranslator() const HELIUM_OVERRIDE;
@@ -116,13 +129,17 @@ namespace Helium
 			virtual Pointer     GetItem( Pointer sequence, size_t at ) HELIUM_OVERRIDE;
 			virtual void        SetItem( Pointer sequence, size_t at, Pointer value ) HELIUM_OVERRIDE;
 			virtual void        Insert( Pointer sequence, size_t at, Pointer value ) HELIUM_OVERRIDE;
+			virtual void        SetItemByMove( Pointer sequence, size_t at, Pointer value ) HELIUM_OVERRIDE;
+			virtual void        InsertByMove( Pointer sequence, size_t at, Pointer value ) HELIUM_OVERRIDE;
 			virtual void        Remove( Pointer sequence, size_t at ) HELIUM_OVERRIDE;
 			virtual void        MoveUp( Pointer sequence, Set< size_t >& items ) HELIUM_OVERRIDE;
 			virtual void        MoveDown( Pointer sequence, Set< size_t >& items ) HELIUM_OVERRIDE;
+			virtual void        AppendRange( Pointer sequence, Pointer values, size_t count ) HELIUM_OVERRIDE;
+			virtual void        InsertRange( Pointer sequence, size_t at, Pointer values, size_t count ) HELIUM_OVERRIDE;
+			virtual void        RemoveRange( Pointer sequence, size_t at, size_t count ) HELIUM_OVERRIDE;
+			virtual void        Reorder( Pointer sequence, const DynamicArray< size_t >& order ) HELIUM_OVERRIDE;
 
 		private:
-			void                SwapInternalValues(Pointer sequence, size_t a, size_t b);
-
 			Translator*         m_InternalTranslator;
 		};
 		
@@ -155,11 +172,16 @@ namespace Helium
 			virtual void        Construct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void        Destruct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void        Copy( Pointer src, Pointer dest, uint32_t flags = 0 ) HELIUM_OVERRIDE;
+			virtual void        Move( Pointer src, Pointer dest ) HELIUM_OVERRIDE;
+			virtual void        Swap( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual bool        Equals( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 
 			// ContainerTranslator
 			virtual size_t      GetLength( Pointer container ) const HELIUM_OVERRIDE;
 			virtual void        Clear( Pointer container ) HELIUM_OVERRIDE;
+			virtual void        Reserve( Pointer container, size_t capacity ) HELIUM_OVERRIDE;
+			virtual bool        Begin( Pointer container, ContainerCursor& cursor ) const HELIUM_OVERRIDE;
+			virtual bool        Next( ContainerCursor& cursor ) const HELIUM_OVERRIDE;
 
 			// SetTranslator
 			virtual Translator* GetItemTranslator() const HELIUM_OVERRIDE;
@@ -201,11 +223,16 @@ namespace Helium
 			virtual void              Construct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void              Destruct( Pointer pointer ) HELIUM_OVERRIDE;
 			virtual void              Copy( Pointer src, Pointer dest, uint32_t flags = 0 ) HELIUM_OVERRIDE;
+			virtual void              Move( Pointer src, Pointer dest ) HELIUM_OVERRIDE;
+			virtual void              Swap( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 			virtual bool              Equals( Pointer a, Pointer b ) HELIUM_OVERRIDE;
 
 			// ContainerTranslator
 			virtual size_t            GetLength( Pointer container ) const HELIUM_OVERRIDE;
 			virtual void              Clear( Pointer container ) HELIUM_OVERRIDE;
+			virtual void              Reserve( Pointer container, size_t capacity ) HELIUM_OVERRIDE;
+			virtual bool              Begin( Pointer container, ContainerCursor& cursor ) const HELIUM_OVERRIDE;
+			virtual bool              Next( ContainerCursor& cursor ) const HELIUM_OVERRIDE;
 
 			// AssociationTranslator
 			virtual ScalarTranslator* GetKeyTranslator() const HELIUM_OVERRIDE;
@@ -213,6 +240,7 @@ namespace Helium
 			virtual void              GetItems( Pointer association, DynamicArray<Pointer>& keys, DynamicArray<Pointer>& values ) HELIUM_OVERRIDE;
 			virtual Pointer           GetItem( Pointer association, Pointer key ) HELIUM_OVERRIDE;
 			virtual void              SetItem( Pointer association, Pointer key, Pointer value ) HELIUM_OVERRIDE;
+			virtual void              SetItemByMove( Pointer association, Pointer key, Pointer value ) HELIUM_OVERRIDE;
 			virtual void              RemoveItem( Pointer association, Pointer key ) HELIUM_OVERRIDE;
 
 		private:
@@ -235,6 +263,112 @@ namespace Helium
 		{
 			return new SimpleMapTranslator<KeyT, ValueT>();
 		}
+		//////////////////////////////////////////////////////////////////////////
+
+		template <class T>
+		class SimpleHashSetTranslator : public SetTranslator
+		{
+		public:
+			SimpleHashSetTranslator();
+			virtual ~SimpleHashSetTranslator();
+
+			// Translator
+			virtual void        Construct( Pointer pointer ) HELIUM_OVERRIDE;
+			virtual void        Destruct( Pointer pointer ) HELIUM_OVERRIDE;
+			virtual void        Copy( Pointer src, Pointer dest, uint32_t flags = 0 ) HELIUM_OVERRIDE;
+			virtual void        Move( Pointer src, Pointer dest ) HELIUM_OVERRIDE;
+			virtual void        Swap( Pointer a, Pointer b ) HELIUM_OVERRIDE;
+			virtual bool        Equals( Pointer a, Pointer b ) HELIUM_OVERRIDE;
+
+			// ContainerTranslator
+			virtual size_t      GetLength( Pointer container ) const HELIUM_OVERRIDE;
+			virtual void        Clear( Pointer container ) HELIUM_OVERRIDE;
+			virtual void        Reserve( Pointer container, size_t capacity ) HELIUM_OVERRIDE;
+			virtual bool        Begin( Pointer container, ContainerCursor& cursor ) const HELIUM_OVERRIDE;
+			virtual bool        Next( ContainerCursor& cursor ) const HELIUM_OVERRIDE;
+
+			// SetTranslator
+			virtual Translator* GetItemTranslator() const HELIUM_OVERRIDE;
+			virtual void        GetItems( Pointer set, DynamicArray< Pointer >& items ) const HELIUM_OVERRIDE;
+			virtual void        InsertItem( Pointer set, Pointer item ) HELIUM_OVERRIDE;
+			virtual void        RemoveItem( Pointer set, Pointer item ) HELIUM_OVERRIDE;
+			virtual bool        ContainsItem( Pointer set, Pointer item ) const HELIUM_OVERRIDE;
+
+		private:
+			Translator*         m_InternalTranslator;
+		};
+		
+		template <class T>
+		inline const MetaType* DeduceKeyType( const HashSet<T>&, const HashSet<T>& )
+		{
+			return NULL;
+		}
+		template <class T>
+		inline const MetaType* DeduceValueType( const HashSet<T>&, const HashSet<T>& )
+		{
+			return DeduceValueType<T>();
+		}
+		template <class T>
+		inline Translator* AllocateTranslator( const HashSet<T>&, const HashSet<T>& )
+		{
+			return new SimpleHashSetTranslator<T>();
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+
+		template <class KeyT, class ValueT>
+		class SimpleHashMapTranslator : public AssociationTranslator
+		{
+		public:
+			SimpleHashMapTranslator();
+			virtual ~SimpleHashMapTranslator();
+
+			// Translator
+			virtual void              Construct( Pointer pointer ) HELIUM_OVERRIDE;
+			virtual void              Destruct( Pointer pointer ) HELIUM_OVERRIDE;
+			virtual void              Copy( Pointer src, Pointer dest, uint32_t flags = 0 ) HELIUM_OVERRIDE;
+			virtual void              Move( Pointer src, Pointer dest ) HELIUM_OVERRIDE;
+			virtual void              Swap( Pointer a, Pointer b ) HELIUM_OVERRIDE;
+			virtual bool              Equals( Pointer a, Pointer b ) HELIUM_OVERRIDE;
+
+			// ContainerTranslator
+			virtual size_t            GetLength( Pointer container ) const HELIUM_OVERRIDE;
+			virtual void              Clear( Pointer container ) HELIUM_OVERRIDE;
+			virtual void              Reserve( Pointer container, size_t capacity ) HELIUM_OVERRIDE;
+			virtual bool              Begin( Pointer container, ContainerCursor& cursor ) const HELIUM_OVERRIDE;
+			virtual bool              Next( ContainerCursor& cursor ) const HELIUM_OVERRIDE;
+
+			// AssociationTranslator
+			virtual ScalarTranslator* GetKeyTranslator() const HELIUM_OVERRIDE;
+			virtual Translator*       GetValueTranslator() const HELIUM_OVERRIDE;
+			virtual void              GetItems( Pointer association, DynamicArray<Pointer>& keys, DynamicArray<Pointer>& values ) HELIUM_OVERRIDE;
+			virtual Pointer           GetItem( Pointer association, Pointer key ) HELIUM_OVERRIDE;
+			virtual void              SetItem( Pointer association, Pointer key, Pointer value ) HELIUM_OVERRIDE;
+			virtual void              SetItemByMove( Pointer association, Pointer key, Pointer value ) HELIUM_OVERRIDE;
+			virtual void              RemoveItem( Pointer association, Pointer key ) HELIUM_OVERRIDE;
+
+		private:
+			static ValueT&      FindOrInsert( HashMap<KeyT, ValueT>& m, const KeyT& key );
+
+			ScalarTranslator*   m_InternalTranslatorKey;
+			Translator*         m_InternalTranslatorValue;
+		};
+		
+		template <class KeyT, class ValueT>
+		inline const MetaType* DeduceKeyType( const HashMap<KeyT, ValueT>&, const HashMap<KeyT, ValueT>& )
+		{
+			return DeduceValueType<KeyT>();
+		}
+		template <class KeyT, class ValueT>
+		inline const MetaType* DeduceValueType( const HashMap<KeyT, ValueT>&, const HashMap<KeyT, ValueT>& )
+		{
+			return DeduceValueType<ValueT>();
+		}
+		template <class KeyT, class ValueT>
+		inline Translator* AllocateTranslator( const HashMap<KeyT, ValueT>&, const HashMap<KeyT, ValueT>& )
+		{
+			return new SimpleHashMapTranslator<KeyT, ValueT>();
+		}
 	}
 }
 
@@ -48,6 +48,22 @@ void Helium::Reflect::SimpleDynamicArrayTranslator<T>::Copy( Pointer src, Pointe
 	}
 }
 
+template <class T>
+void Helium::Reflect::SimpleDynamicArrayTranslator<T>::Move( Pointer src, Pointer dest )
+{
+	if ( src.m_Address != dest.m_Address )
+	{
+		dest.As< DynamicArray<T> >().Swap( src.As< DynamicArray<T> >() );
+		src.As< DynamicArray<T> >().Clear();
+	}
+}
+
+template <class T>
+void Helium::Reflect::SimpleDynamicArrayTranslator<T>::Swap( Pointer a, Pointer b )
+{
+	a.As< DynamicArray<T> >().Swap( b.As< DynamicArray<T> >() );
+}
+
 template <class T>
 bool Helium::Reflect::SimpleDynamicArrayTranslator<T>::Equals( Pointer a, Pointer b )
 {
@@ -93,6 +109,33 @@ void Helium::Reflect::SimpleDynamicArrayTranslator<T>::Clear( Pointer container
 	v.Clear();
 }
 
+template <class T>
+void Helium::Reflect::SimpleDynamicArrayTranslator<T>::Reserve( Pointer container, size_t capacity )
+{
+	DynamicArray<T> &v = container.As< DynamicArray<T> >();
+	v.Reserve(capacity);
+}
+
+template <class T>
+bool Helium::Reflect::SimpleDynamicArrayTranslator<T>::Begin( Pointer container, ContainerCursor& cursor ) const
+{
+	DynamicArray<T> &c = container.As< DynamicArray<T> >();
+	cursor.Reset( container, c.Begin(), c.End() );
+
+	ContainerCursor::Range< typename DynamicArray<T>::Iterator >& range = cursor.GetRange< typename DynamicArray<T>::Iterator >();
+	return range.m_Current != range.m_End ? cursor.SetCurrent( &*range.m_Current ) : cursor.SetEnd();
+}
+
+template <class T>
+bool Helium::Reflect::SimpleDynamicArrayTranslator<T>::Next( ContainerCursor& cursor ) const
+{
+	HELIUM_ASSERT( cursor.IsValid() );
+
+	ContainerCursor::Range< typename DynamicArray<T>::Iterator >& range = cursor.GetRange< typename DynamicArray<T>::Iterator >();
+	++range.m_Current;
+	return range.m_Current != range.m_End ? cursor.SetCurrent( &*range.m_Current ) : cursor.SetEnd();
+}
+
 template <class T>
 Helium::Reflect::Translator* Helium::Reflect::SimpleDynamicArrayTranslator<T>::GetItemTranslator() const
 {
@@ -140,6 +183,21 @@ void Helium::Reflect::SimpleDynamicArrayTranslator<T>::Insert( Pointer sequence,
 	v.Insert(at, value.As<T>());
 }
 
+template <class T>
+void Helium::Reflect::SimpleDynamicArrayTranslator<T>::SetItemByMove( Pointer sequence, size_t at, Pointer value )
+{
+	DynamicArray<T> &v = sequence.As< DynamicArray<T> >();
+	m_InternalTranslator->Move(value, Pointer(&v[at], sequence.m_Field, sequence.m_Object));
+}
+
+template <class T>
+void Helium::Reflect::SimpleDynamicArrayTranslator<T>::InsertByMove( Pointer sequence, size_t at, Pointer value )
+{
+	DynamicArray<T> &v = sequence.As< DynamicArray<T> >();
+	v.Insert(at, T());
+	m_InternalTranslator->Move(value, Pointer(&v[at], sequence.m_Field, sequence.m_Object));
+}
+
 template <class T>
 void Helium::Reflect::SimpleDynamicArrayTranslator<T>::Remove( Pointer sequence, size_t at )
 {
@@ -150,64 +208,55 @@ void Helium::Reflect::SimpleDynamicArrayTranslator<T>::Remove( Pointer sequence,
 template <class T>
 void Helium::Reflect::SimpleDynamicArrayTranslator<T>::MoveUp( Pointer sequence, Set< size_t >& items )
 {
-	for (Set<size_t>::Iterator iter = items.Begin(); 
-		iter != items.End(); ++iter)
+	DynamicArray< size_t > order;
+	if (GetMoveUpOrder(GetLength(sequence), items, order))
 	{
-		size_t index = *iter;
-
-		if (index <= 0)
-		{
-			continue;
-		}
-
-		SwapInternalValues(sequence, index, index - 1);
+		Reorder(sequence, order);
+		sequence.RaiseChanged();
 	}
 }
 
 template <class T>
 void Helium::Reflect::SimpleDynamicArrayTranslator<T>::MoveDown( Pointer sequence, Set< size_t >& items )
 {
-	DynamicArray<T> &v = sequence.As< DynamicArray<T> >();
-
-	for (Set<size_t>::Iterator iter = items.End() - 1; 
-		iter >= items.Begin(); --iter)
+	DynamicArray< size_t > order;
+	if (GetMoveDownOrder(GetLength(sequence), items, order))
 	{
-		size_t index = *iter;
-
-		if (index >= v.GetSize() - 1)
-		{
-			continue;
-		}
-
-		SwapInternalValues(sequence, index, index + 1);
+		Reorder(sequence, order);
+		sequence.RaiseChanged();
 	}
 }
 
 template <class T>
-void Helium::Reflect::SimpleDynamicArrayTranslator<T>::SwapInternalValues( Pointer sequence, size_t a, size_t b )
+void Helium::Reflect::SimpleDynamicArrayTranslator<T>::AppendRange( Pointer sequence, Pointer values, size_t count )
 {
 	DynamicArray<T> &v = sequence.As< DynamicArray<T> >();
+	v.AddArray(&values.As<T>(), count);
+}
 
-	HELIUM_ASSERT(a >= 0);
-	HELIUM_ASSERT(b >= 0);
-
-	HELIUM_ASSERT(a < v.GetSize());
-	HELIUM_ASSERT(b < v.GetSize());
-
-	HELIUM_ASSERT(a != b);
-
-	T temp;
+template <class T>
+void Helium::Reflect::SimpleDynamicArrayTranslator<T>::InsertRange( Pointer sequence, size_t at, Pointer values, size_t count )
+{
+	DynamicArray<T> &v = sequence.As< DynamicArray<T> >();
+	HELIUM_ASSERT(at <= v.GetSize());
+	v.InsertArray(at, &values.As<T>(), count);
+}
 
-	typename DynamicArray<T>::Iterator iter_a = v.Begin() + a;
-	typename DynamicArray<T>::Iterator iter_b = v.Begin() + b;
+template <class T>
+void Helium::Reflect::SimpleDynamicArrayTranslator<T>::RemoveRange( Pointer sequence, size_t at, size_t count )
+{
+	DynamicArray<T> &v = sequence.As< DynamicArray<T> >();
+	HELIUM_ASSERT(at + count <= v.GetSize());
+	v.Remove(at, count);
+}
 
-	Pointer dp_a(&*iter_a, sequence.m_Field, sequence.m_Object);
-	Pointer dp_b(&*iter_b, sequence.m_Field, sequence.m_Object);
-	Pointer dp_temp(&temp, sequence.m_Field, sequence.m_Object);
+template <class T>
+void Helium::Reflect::SimpleDynamicArrayTranslator<T>::Reorder( Pointer sequence, const DynamicArray< size_t >& order )
+{
+	DynamicArray<T> &v = sequence.As< DynamicArray<T> >();
+	HELIUM_ASSERT(order.GetSize() == v.GetSize());
 
-	m_InternalTranslator->Copy(dp_a, dp_temp);
-	m_InternalTranslator->Copy(dp_b, dp_a);
-	m_InternalTranslator->Copy(dp_temp, dp_b, CopyFlags::Notify);
+	SwapIntoOrder(sequence, order);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -263,6 +312,22 @@ void Helium::Reflect::SimpleSetTranslator<T>::Copy( Pointer src, Pointer dest, u
 	}
 }
 
+template <class T>
+void Helium::Reflect::SimpleSetTranslator<T>::Move( Pointer src, Pointer dest )
+{
+	if ( src.m_Address != dest.m_Address )
+	{
+		dest.As< Set<T> >().Swap( src.As< Set<T> >() );
+		src.As< Set<T> >().Clear();
+	}
+}
+
+template <class T>
+void Helium::Reflect::SimpleSetTranslator<T>::Swap( Pointer a, Pointer b )
+{
+	a.As< Set<T> >().Swap( b.As< Set<T> >() );
+}
+
 template <class T>
 bool Helium::Reflect::SimpleSetTranslator<T>::Equals( Pointer a, Pointer b )
 {
@@ -311,6 +376,33 @@ void Helium::Reflect::SimpleSetTranslator<T>::Clear( Pointer container )
 	s.Clear();
 }
 
+template <class T>
+void Helium::Reflect::SimpleSetTranslator<T>::Reserve( Pointer container, size_t capacity )
+{
+	Set<T> &v = container.As< Set<T> >();
+	v.Reserve(capacity);
+}
+
+template <class T>
+bool Helium::Reflect::SimpleSetTranslator<T>::Begin( Pointer container, ContainerCursor& cursor ) const
+{
+	Set<T> &c = container.As< Set<T> >();
+	cursor.Reset( container, c.Begin(), c.End() );
+
+	ContainerCursor::Range< typename Set<T>::Iterator >& range = cursor.GetRange< typename Set<T>::Iterator >();
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<T *>(&*range.m_Current) ) : cursor.SetEnd();
+}
+
+template <class T>
+bool Helium::Reflect::SimpleSetTranslator<T>::Next( ContainerCursor& cursor ) const
+{
+	HELIUM_ASSERT( cursor.IsValid() );
+
+	ContainerCursor::Range< typename Set<T>::Iterator >& range = cursor.GetRange< typename Set<T>::Iterator >();
+	++range.m_Current;
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<T *>(&*range.m_Current) ) : cursor.SetEnd();
+}
+
 template <class T>
 Helium::Reflect::Translator* Helium::Reflect::SimpleSetTranslator<T>::GetItemTranslator() const
 {
@@ -434,6 +526,22 @@ void Helium::Reflect::SimpleMapTranslator<KeyT, ValueT>::Copy( Pointer src, Poin
 	}
 }
 
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleMapTranslator<KeyT, ValueT>::Move( Pointer src, Pointer dest )
+{
+	if ( src.m_Address != dest.m_Address )
+	{
+		dest.As< Map<KeyT, ValueT> >().Swap( src.As< Map<KeyT, ValueT> >() );
+		src.As< Map<KeyT, ValueT> >().Clear();
+	}
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleMapTranslator<KeyT, ValueT>::Swap( Pointer a, Pointer b )
+{
+	a.As< Map<KeyT, ValueT> >().Swap( b.As< Map<KeyT, ValueT> >() );
+}
+
 template <class KeyT, class ValueT>
 bool Helium::Reflect::SimpleMapTranslator<KeyT, ValueT>::Equals( Pointer a, Pointer b ) 
 {
@@ -454,6 +562,33 @@ void Helium::Reflect::SimpleMapTranslator<KeyT, ValueT>::Clear( Pointer containe
 	return m.Clear();
 }
 
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleMapTranslator<KeyT, ValueT>::Reserve( Pointer container, size_t capacity )
+{
+	Map<KeyT, ValueT> &v = container.As< Map<KeyT, ValueT> >();
+	v.Reserve(capacity);
+}
+
+template <class KeyT, class ValueT>
+bool Helium::Reflect::SimpleMapTranslator<KeyT, ValueT>::Begin( Pointer container, ContainerCursor& cursor ) const
+{
+	Map<KeyT, ValueT> &c = container.As< Map<KeyT, ValueT> >();
+	cursor.Reset( container, c.Begin(), c.End() );
+
+	ContainerCursor::Range< typename Map<KeyT, ValueT>::Iterator >& range = cursor.GetRange< typename Map<KeyT, ValueT>::Iterator >();
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<KeyT *>(&range.m_Current->First()), &range.m_Current->Second() ) : cursor.SetEnd();
+}
+
+template <class KeyT, class ValueT>
+bool Helium::Reflect::SimpleMapTranslator<KeyT, ValueT>::Next( ContainerCursor& cursor ) const
+{
+	HELIUM_ASSERT( cursor.IsValid() );
+
+	ContainerCursor::Range< typename Map<KeyT, ValueT>::Iterator >& range = cursor.GetRange< typename Map<KeyT, ValueT>::Iterator >();
+	++range.m_Current;
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<KeyT *>(&range.m_Current->First()), &range.m_Current->Second() ) : cursor.SetEnd();
+}
+
 template <class KeyT, class ValueT>
 Helium::Reflect::ScalarTranslator* Helium::Reflect::SimpleMapTranslator<KeyT, ValueT>::GetKeyTranslator() const
 {
@@ -492,6 +627,13 @@ void Helium::Reflect::SimpleMapTranslator<KeyT, ValueT>::SetItem( Pointer associ
 	m[key.As<KeyT>()] = value.As<ValueT>();
 }
 
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleMapTranslator<KeyT, ValueT>::SetItemByMove( Pointer association, Pointer key, Pointer value )
+{
+	Map<KeyT, ValueT> &m = association.As< Map<KeyT, ValueT> >();
+	m_InternalTranslatorValue->Move(value, Pointer(&m[key.As<KeyT>()], association.m_Field, association.m_Object));
+}
+
 template <class KeyT, class ValueT>
 void Helium::Reflect::SimpleMapTranslator<KeyT, ValueT>::RemoveItem( Pointer association, Pointer key )
 {
@@ -511,3 +653,398 @@ void Helium::Reflect::SimpleMapTranslator<KeyT, ValueT>::RemoveItem( Pointer ass
 		m.Remove(iter);
 	}
 }
+
+//////////////////////////////////////////////////////////////////////////
+
+template <class T>
+Helium::Reflect::SimpleHashSetTranslator<T>::SimpleHashSetTranslator()
+	: SetTranslator(sizeof(HashSet<T>))
+	, m_InternalTranslator(AllocateTranslator<T>())
+{
+
+}
+
+template <class T>
+Helium::Reflect::SimpleHashSetTranslator<T>::~SimpleHashSetTranslator()
+{
+	delete m_InternalTranslator;
+}
+
+template <class T>
+void Helium::Reflect::SimpleHashSetTranslator<T>::Construct( Pointer pointer )
+{
+	DefaultConstruct< HashSet<T> >(pointer);
+}
+
+template <class T>
+void Helium::Reflect::SimpleHashSetTranslator<T>::Destruct( Pointer pointer )
+{
+	DefaultDestruct< HashSet<T> >(pointer);
+}
+
+template <class T>
+void Helium::Reflect::SimpleHashSetTranslator<T>::Copy( Pointer src, Pointer dest, uint32_t flags /*= 0 */ )
+{
+	if (flags & CopyFlags::Shallow)
+	{
+		DefaultCopy< HashSet< T > >(src, dest, flags);
+		return;
+	}
+
+	HashSet<T> &s_src = src.As< HashSet<T> >();
+	HashSet<T> &s_dest = dest.As< HashSet<T> >();
+
+	s_dest.Clear();
+	s_dest.Reserve(s_src.GetSize());
+
+	for ( typename HashSet<T>::Iterator iter_src = s_src.Begin(); iter_src != s_src.End(); ++iter_src )
+	{
+		// Should be safe since we copy FROM this. Should not break const-ness (might increase a ref count or something like that though)
+		Pointer dp_src(const_cast<T *>(&*iter_src), src.m_Field, src.m_Object);
+		T temp;
+		Pointer dp_dest(&temp, dest.m_Field, dest.m_Object);
+		m_InternalTranslator->Copy(dp_src, dp_dest, flags);
+		s_dest.Insert(temp);
+	}
+}
+
+template <class T>
+void Helium::Reflect::SimpleHashSetTranslator<T>::Move( Pointer src, Pointer dest )
+{
+	if ( src.m_Address != dest.m_Address )
+	{
+		dest.As< HashSet<T> >().Swap( src.As< HashSet<T> >() );
+		src.As< HashSet<T> >().Clear();
+	}
+}
+
+template <class T>
+void Helium::Reflect::SimpleHashSetTranslator<T>::Swap( Pointer a, Pointer b )
+{
+	a.As< HashSet<T> >().Swap( b.As< HashSet<T> >() );
+}
+
+template <class T>
+bool Helium::Reflect::SimpleHashSetTranslator<T>::Equals( Pointer a, Pointer b )
+{
+	HashSet<T> &s_a = a.As< HashSet<T> >();
+	HashSet<T> &s_b = b.As< HashSet<T> >();
+
+	if (s_a.GetSize() != s_b.GetSize())
+	{
+		return false;
+	}
+
+	for ( typename HashSet<T>::Iterator iter = s_a.Begin(); iter != s_a.End(); ++iter )
+	{
+		if (s_b.Find(*iter) == s_b.End())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <class T>
+size_t Helium::Reflect::SimpleHashSetTranslator<T>::GetLength( Pointer container ) const
+{
+	HashSet<T> &s = container.As< HashSet<T> >();
+	return s.GetSize();
+}
+
+template <class T>
+void Helium::Reflect::SimpleHashSetTranslator<T>::Clear( Pointer container )
+{
+	HashSet<T> &s = container.As< HashSet<T> >();
+	s.Clear();
+}
+
+template <class T>
+void Helium::Reflect::SimpleHashSetTranslator<T>::Reserve( Pointer container, size_t capacity )
+{
+	HashSet<T> &v = container.As< HashSet<T> >();
+	v.Reserve(capacity);
+}
+
+template <class T>
+bool Helium::Reflect::SimpleHashSetTranslator<T>::Begin( Pointer container, ContainerCursor& cursor ) const
+{
+	HashSet<T> &c = container.As< HashSet<T> >();
+	cursor.Reset( container, c.Begin(), c.End() );
+
+	ContainerCursor::Range< typename HashSet<T>::Iterator >& range = cursor.GetRange< typename HashSet<T>::Iterator >();
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<T *>(&*range.m_Current) ) : cursor.SetEnd();
+}
+
+template <class T>
+bool Helium::Reflect::SimpleHashSetTranslator<T>::Next( ContainerCursor& cursor ) const
+{
+	HELIUM_ASSERT( cursor.IsValid() );
+
+	ContainerCursor::Range< typename HashSet<T>::Iterator >& range = cursor.GetRange< typename HashSet<T>::Iterator >();
+	++range.m_Current;
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<T *>(&*range.m_Current) ) : cursor.SetEnd();
+}
+
+template <class T>
+Helium::Reflect::Translator* Helium::Reflect::SimpleHashSetTranslator<T>::GetItemTranslator() const
+{
+	return m_InternalTranslator;
+}
+
+template <class T>
+void Helium::Reflect::SimpleHashSetTranslator<T>::GetItems( Pointer set, DynamicArray< Pointer >& items ) const
+{
+	HashSet<T> &v = set.As< HashSet<T> >();
+	items.Reserve(v.GetSize());
+
+	for ( typename HashSet<T>::Iterator iter = v.Begin(); iter != v.End(); ++iter )
+	{
+		// This is dangerous.. callers could modify values passed out
+		Pointer dp(const_cast<T *>(&*iter), set.m_Field, set.m_Object);
+		items.Add(dp);
+	}
+}
+
+template <class T>
+void Helium::Reflect::SimpleHashSetTranslator<T>::InsertItem( Pointer set, Pointer item )
+{
+	HashSet<T> &v = set.As< HashSet<T> >();
+	v.Insert( typename HashSet<T>::ValueType(item.As<T>()) );
+}
+
+template <class T>
+void Helium::Reflect::SimpleHashSetTranslator<T>::RemoveItem( Pointer set, Pointer item )
+{
+	HashSet<T> &v = set.As< HashSet<T> >();
+	v.Remove( typename HashSet<T>::ValueType(item.As<T>()) );
+}
+
+template <class T>
+bool Helium::Reflect::SimpleHashSetTranslator<T>::ContainsItem( Pointer set, Pointer item ) const
+{
+	HashSet<T> &s = set.As< HashSet<T> >();
+
+	typename HashSet<T>::Iterator iter = s.Find(item.As<T>());
+	return iter != s.End();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+template <class KeyT, class ValueT>
+Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::SimpleHashMapTranslator()
+	: AssociationTranslator(sizeof(HashMap<KeyT, ValueT>))
+	, m_InternalTranslatorKey(ReflectionCast< ScalarTranslator >( AllocateTranslator<KeyT>() ))
+	, m_InternalTranslatorValue(AllocateTranslator<ValueT>())
+{
+	HELIUM_ASSERT( m_InternalTranslatorKey );
+}
+
+template <class KeyT, class ValueT>
+Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::~SimpleHashMapTranslator()
+{
+	delete m_InternalTranslatorKey;
+	delete m_InternalTranslatorValue;
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::Construct( Pointer pointer ) 
+{
+	DefaultConstruct< HashMap<KeyT, ValueT> >(pointer);
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::Destruct( Pointer pointer ) 
+{
+	DefaultDestruct< HashMap<KeyT, ValueT> >(pointer);
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::Copy( Pointer src, Pointer dest, uint32_t flags /*= 0 */ ) 
+{
+	if (flags & CopyFlags::Shallow)
+	{
+		DefaultCopy< HashMap< KeyT, ValueT > >(src, dest, flags);
+		return;
+	}
+
+	HashMap<KeyT, ValueT> &m_src = src.As< HashMap<KeyT, ValueT> >();
+	HashMap<KeyT, ValueT> &m_dest = dest.As< HashMap<KeyT, ValueT> >();
+
+	m_dest.Clear();
+	m_dest.Reserve(m_src.GetSize());
+
+	for ( typename HashMap<KeyT, ValueT>::Iterator iter_src = m_src.Begin(); iter_src != m_src.End(); ++iter_src )
+	{
+		// Should be safe since we copy FROM this. Should not break const-ness (might increase a ref count or something like that though)
+		Pointer dp_src_key(const_cast<KeyT *>(&iter_src->First()), src.m_Field, src.m_Object);
+		Pointer dp_src_value(&iter_src->Second(), src.m_Field, src.m_Object);
+
+		typename HashMap<KeyT, ValueT>::ValueType temp;
+
+		Pointer dp_dest_key(const_cast<KeyT *>(&temp.First()), dest.m_Field, dest.m_Object);
+		Pointer dp_dest_value(&temp.Second(), dest.m_Field, dest.m_Object);
+
+		m_InternalTranslatorKey->Copy(dp_src_key, dp_dest_key, flags);
+		m_InternalTranslatorValue->Copy(dp_src_value, dp_dest_value, flags);
+
+		m_dest.Insert(temp);
+	}
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::Move( Pointer src, Pointer dest )
+{
+	if ( src.m_Address != dest.m_Address )
+	{
+		dest.As< HashMap<KeyT, ValueT> >().Swap( src.As< HashMap<KeyT, ValueT> >() );
+		src.As< HashMap<KeyT, ValueT> >().Clear();
+	}
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::Swap( Pointer a, Pointer b )
+{
+	a.As< HashMap<KeyT, ValueT> >().Swap( b.As< HashMap<KeyT, ValueT> >() );
+}
+
+template <class KeyT, class ValueT>
+bool Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::Equals( Pointer a, Pointer b ) 
+{
+	HashMap<KeyT, ValueT> &m_a = a.As< HashMap<KeyT, ValueT> >();
+	HashMap<KeyT, ValueT> &m_b = b.As< HashMap<KeyT, ValueT> >();
+
+	if (m_a.GetSize() != m_b.GetSize())
+	{
+		return false;
+	}
+
+	for ( typename HashMap<KeyT, ValueT>::Iterator iter_a = m_a.Begin(); iter_a != m_a.End(); ++iter_a )
+	{
+		typename HashMap<KeyT, ValueT>::Iterator iter_b = m_b.Find(iter_a->First());
+		if (iter_b == m_b.End())
+		{
+			return false;
+		}
+
+		Pointer dp_a(&iter_a->Second(), a.m_Field, a.m_Object);
+		Pointer dp_b(&iter_b->Second(), b.m_Field, b.m_Object);
+		if (!m_InternalTranslatorValue->Equals(dp_a, dp_b))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <class KeyT, class ValueT>
+size_t Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::GetLength( Pointer container ) const 
+{
+	HashMap<KeyT, ValueT> &m = container.As< HashMap<KeyT, ValueT> >();
+	return m.GetSize();
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::Clear( Pointer container ) 
+{
+	HashMap<KeyT, ValueT> &m = container.As< HashMap<KeyT, ValueT> >();
+	return m.Clear();
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::Reserve( Pointer container, size_t capacity )
+{
+	HashMap<KeyT, ValueT> &v = container.As< HashMap<KeyT, ValueT> >();
+	v.Reserve(capacity);
+}
+
+template <class KeyT, class ValueT>
+bool Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::Begin( Pointer container, ContainerCursor& cursor ) const
+{
+	HashMap<KeyT, ValueT> &c = container.As< HashMap<KeyT, ValueT> >();
+	cursor.Reset( container, c.Begin(), c.End() );
+
+	ContainerCursor::Range< typename HashMap<KeyT, ValueT>::Iterator >& range = cursor.GetRange< typename HashMap<KeyT, ValueT>::Iterator >();
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<KeyT *>(&range.m_Current->First()), &range.m_Current->Second() ) : cursor.SetEnd();
+}
+
+template <class KeyT, class ValueT>
+bool Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::Next( ContainerCursor& cursor ) const
+{
+	HELIUM_ASSERT( cursor.IsValid() );
+
+	ContainerCursor::Range< typename HashMap<KeyT, ValueT>::Iterator >& range = cursor.GetRange< typename HashMap<KeyT, ValueT>::Iterator >();
+	++range.m_Current;
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<KeyT *>(&range.m_Current->First()), &range.m_Current->Second() ) : cursor.SetEnd();
+}
+
+template <class KeyT, class ValueT>
+Helium::Reflect::ScalarTranslator* Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::GetKeyTranslator() const
+{
+	return m_InternalTranslatorKey;
+}
+
+template <class KeyT, class ValueT>
+Helium::Reflect::Translator* Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::GetValueTranslator() const
+{
+	return m_InternalTranslatorValue;
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::GetItems( Pointer association, DynamicArray<Pointer>& keys, DynamicArray<Pointer>& values )
+{
+	HashMap<KeyT, ValueT> &m = association.As< HashMap<KeyT, ValueT> >();
+
+	for ( typename HashMap<KeyT, ValueT>::Iterator iter = m.Begin(); iter != m.End(); ++iter )
+	{
+		keys.Add(Pointer(const_cast<KeyT *>(&iter->First()), association.m_Field, association.m_Object));
+		values.Add(Pointer(&iter->Second(), association.m_Field, association.m_Object));
+	}
+}
+
+template <class KeyT, class ValueT>
+Helium::Reflect::Pointer Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::GetItem( Pointer association, Pointer key )
+{
+	HashMap<KeyT, ValueT> &m = association.As< HashMap<KeyT, ValueT> >();
+	return Pointer(&FindOrInsert(m, key.As<KeyT>()), association.m_Field, association.m_Object);
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::SetItem( Pointer association, Pointer key, Pointer value )
+{
+	HashMap<KeyT, ValueT> &m = association.As< HashMap<KeyT, ValueT> >();
+	FindOrInsert(m, key.As<KeyT>()) = value.As<ValueT>();
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::SetItemByMove( Pointer association, Pointer key, Pointer value )
+{
+	HashMap<KeyT, ValueT> &m = association.As< HashMap<KeyT, ValueT> >();
+	m_InternalTranslatorValue->Move(value, Pointer(&FindOrInsert(m, key.As<KeyT>()), association.m_Field, association.m_Object));
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::RemoveItem( Pointer association, Pointer key )
+{
+	HashMap<KeyT, ValueT> &m = association.As< HashMap<KeyT, ValueT> >();
+	typename HashMap<KeyT, ValueT>::Iterator iter = m.Find(key.As<KeyT>());
+
+	if (iter != m.End())
+	{
+		m.Remove(iter);
+	}
+}
+
+template <class KeyT, class ValueT>
+ValueT& Helium::Reflect::SimpleHashMapTranslator<KeyT, ValueT>::FindOrInsert( HashMap<KeyT, ValueT>& m, const KeyT& key )
+{
+	typename HashMap<KeyT, ValueT>::Iterator iter = m.Find(key);
+	if (iter == m.End())
+	{
+		iter = m.Insert(typename HashMap<KeyT, ValueT>::ValueType(key, ValueT())).First();
+	}
+
+	return iter->Second();
+}
@@ -26,6 +26,20 @@ void StlStringTranslator::Copy( Pointer src, Pointer dest, uint32_t flags )
 	DefaultCopy< std::string >( src, dest, flags );
 }
 
+void StlStringTranslator::Move( Pointer src, Pointer dest )
+{
+	if ( src.m_Address != dest.m_Address )
+	{
+		dest.As< std::string >().swap( src.As< std::string >() );
+		src.As< std::string >().clear();
+	}
+}
+
+void StlStringTranslator::Swap( Pointer a, Pointer b )
+{
+	a.As< std::string >().swap( b.As< std::string >() );
+}
+
 bool StlStringTranslator::Equals( Pointer a, Pointer b )
 {
 	return DefaultEquals< std::string >( a, b );
@@ -49,6 +49,22 @@ void Helium::Reflect::SimpleStlVectorTranslator<T>::Copy( Pointer src, Pointer d
 	}
 }
 
+template <class T>
+void Helium::Reflect::SimpleStlVectorTranslator<T>::Move( Pointer src, Pointer dest )
+{
+	if ( src.m_Address != dest.m_Address )
+	{
+		dest.As< std::vector<T> >().swap( src.As< std::vector<T> >() );
+		src.As< std::vector<T> >().clear();
+	}
+}
+
+template <class T>
+void Helium::Reflect::SimpleStlVectorTranslator<T>::Swap( Pointer a, Pointer b )
+{
+	a.As< std::vector<T> >().swap( b.As< std::vector<T> >() );
+}
+
 template <class T>
 bool Helium::Reflect::SimpleStlVectorTranslator<T>::Equals( Pointer a, Pointer b )
 {
@@ -94,6 +110,33 @@ void Helium::Reflect::SimpleStlVectorTranslator<T>::Clear( Pointer container )
 	v.clear();
 }
 
+template <class T>
+void Helium::Reflect::SimpleStlVectorTranslator<T>::Reserve( Pointer container, size_t capacity )
+{
+	std::vector<T> &v = container.As< std::vector<T> >();
+	v.reserve(capacity);
+}
+
+template <class T>
+bool Helium::Reflect::SimpleStlVectorTranslator<T>::Begin( Pointer container, ContainerCursor& cursor ) const
+{
+	std::vector<T> &c = container.As< std::vector<T> >();
+	cursor.Reset( container, c.begin(), c.end() );
+
+	ContainerCursor::Range< typename std::vector<T>::iterator >& range = cursor.GetRange< typename std::vector<T>::iterator >();
+	return range.m_Current != range.m_End ? cursor.SetCurrent( &*range.m_Current ) : cursor.SetEnd();
+}
+
+template <class T>
+bool Helium::Reflect::SimpleStlVectorTranslator<T>::Next( ContainerCursor& cursor ) const
+{
+	HELIUM_ASSERT( cursor.IsValid() );
+
+	ContainerCursor::Range< typename std::vector<T>::iterator >& range = cursor.GetRange< typename std::vector<T>::iterator >();
+	++range.m_Current;
+	return range.m_Current != range.m_End ? cursor.SetCurrent( &*range.m_Current ) : cursor.SetEnd();
+}
+
 template <class T>
 Helium::Reflect::Translator* Helium::Reflect::SimpleStlVectorTranslator<T>::GetItemTranslator() const
 {
@@ -141,6 +184,21 @@ void Helium::Reflect::SimpleStlVectorTranslator<T>::Insert( Pointer sequence, si
 	v.insert(v.begin() + at, value.As<T>());
 }
 
+template <class T>
+void Helium::Reflect::SimpleStlVectorTranslator<T>::SetItemByMove( Pointer sequence, size_t at, Pointer value )
+{
+	std::vector<T> &v = sequence.As< std::vector<T> >();
+	m_InternalTranslator->Move(value, Pointer(&v[at], sequence.m_Field, sequence.m_Object));
+}
+
+template <class T>
+void Helium::Reflect::SimpleStlVectorTranslator<T>::InsertByMove( Pointer sequence, size_t at, Pointer value )
+{
+	std::vector<T> &v = sequence.As< std::vector<T> >();
+	v.insert(v.begin() + at, T());
+	m_InternalTranslator->Move(value, Pointer(&v[at], sequence.m_Field, sequence.m_Object));
+}
+
 template <class T>
 void Helium::Reflect::SimpleStlVectorTranslator<T>::Remove( Pointer sequence, size_t at )
 {
@@ -151,64 +209,55 @@ void Helium::Reflect::SimpleStlVectorTranslator<T>::Remove( Pointer sequence, si
 template <class T>
 void Helium::Reflect::SimpleStlVectorTranslator<T>::MoveUp( Pointer sequence, Set< size_t >& items )
 {
-	for (Set<size_t>::Iterator iter = items.Begin(); 
-		iter != items.End(); ++iter)
+	DynamicArray< size_t > order;
+	if (GetMoveUpOrder(GetLength(sequence), items, order))
 	{
-		size_t index = *iter;
-
-		if (index <= 0)
-		{
-			continue;
-		}
-
-		SwapInternalValues(sequence, index, index - 1);
+		Reorder(sequence, order);
+		sequence.RaiseChanged();
 	}
 }
 
 template <class T>
 void Helium::Reflect::SimpleStlVectorTranslator<T>::MoveDown( Pointer sequence, Set< size_t >& items )
 {
-	std::vector<T> &v = sequence.As< std::vector<T> >();
-
-	for (Set<size_t>::Iterator iter = items.End() - 1; 
-		iter >= items.Begin(); --iter)
+	DynamicArray< size_t > order;
+	if (GetMoveDownOrder(GetLength(sequence), items, order))
 	{
-		size_t index = *iter;
-
-		if (index >= v.size() - 1)
-		{
-			continue;
-		}
-
-		SwapInternalValues(sequence, index, index + 1);
+		Reorder(sequence, order);
+		sequence.RaiseChanged();
 	}
 }
 
 template <class T>
-void Helium::Reflect::SimpleStlVectorTranslator<T>::SwapInternalValues( Pointer sequence, size_t a, size_t b )
+void Helium::Reflect::SimpleStlVectorTranslator<T>::AppendRange( Pointer sequence, Pointer values, size_t count )
 {
 	std::vector<T> &v = sequence.As< std::vector<T> >();
+	v.insert(v.end(), &values.As<T>(), &values.As<T>() + count);
+}
 
-	HELIUM_ASSERT(a >= 0);
-	HELIUM_ASSERT(b >= 0);
-
-	HELIUM_ASSERT(a < v.size());
-	HELIUM_ASSERT(b < v.size());
-
-	HELIUM_ASSERT(a != b);
-
-	T temp;
+template <class T>
+void Helium::Reflect::SimpleStlVectorTranslator<T>::InsertRange( Pointer sequence, size_t at, Pointer values, size_t count )
+{
+	std::vector<T> &v = sequence.As< std::vector<T> >();
+	HELIUM_ASSERT(at <= v.size());
+	v.insert(v.begin() + at, &values.As<T>(), &values.As<T>() + count);
+}
 
-	typename std::vector<T>::iterator iter_a = v.begin() + a;
-	typename std::vector<T>::iterator iter_b = v.begin() + b;
+template <class T>
+void Helium::Reflect::SimpleStlVectorTranslator<T>::RemoveRange( Pointer sequence, size_t at, size_t count )
+{
+	std::vector<T> &v = sequence.As< std::vector<T> >();
+	HELIUM_ASSERT(at + count <= v.size());
+	v.erase(v.begin() + at, v.begin() + at + count);
+}
 
-	Pointer dp_a(&*iter_a, sequence.m_Field, sequence.m_Object);
-	Pointer dp_b(&*iter_b, sequence.m_Field, sequence.m_Object);
-	Pointer dp_temp(&temp, sequence.m_Field, sequence.m_Object);
+template <class T>
+void Helium::Reflect::SimpleStlVectorTranslator<T>::Reorder( Pointer sequence, const DynamicArray< size_t >& order )
+{
+	std::vector<T> &v = sequence.As< std::vector<T> >();
+	HELIUM_ASSERT(order.GetSize() == v.size());
 
-	m_InternalTranslator->Copy(dp_a, dp_temp);
-	m_InternalTranslator->Copy(dp_b, dp_a);
-	m_InternalTranslator->Copy(dp_temp, dp_b, CopyFlags::Notify);
+	SwapIntoOrder(sequence, order);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -264,6 +313,22 @@ void Helium::Reflect::SimpleStlSetTranslator<T>::Copy( Pointer src, Pointer dest
 	}
 }
 
+template <class T>
+void Helium::Reflect::SimpleStlSetTranslator<T>::Move( Pointer src, Pointer dest )
+{
+	if ( src.m_Address != dest.m_Address )
+	{
+		dest.As< std::set<T> >().swap( src.As< std::set<T> >() );
+		src.As< std::set<T> >().clear();
+	}
+}
+
+template <class T>
+void Helium::Reflect::SimpleStlSetTranslator<T>::Swap( Pointer a, Pointer b )
+{
+	a.As< std::set<T> >().swap( b.As< std::set<T> >() );
+}
+
 template <class T>
 bool Helium::Reflect::SimpleStlSetTranslator<T>::Equals( Pointer a, Pointer b )
 {
@@ -312,6 +377,32 @@ void Helium::Reflect::SimpleStlSetTranslator<T>::Clear( Pointer container )
 	s.clear();
 }
 
+template <class T>
+void Helium::Reflect::SimpleStlSetTranslator<T>::Reserve( Pointer container, size_t capacity )
+{
+	// node based, nothing to preallocate
+}
+
+template <class T>
+bool Helium::Reflect::SimpleStlSetTranslator<T>::Begin( Pointer container, ContainerCursor& cursor ) const
+{
+	std::set<T> &c = container.As< std::set<T> >();
+	cursor.Reset( container, c.begin(), c.end() );
+
+	ContainerCursor::Range< typename std::set<T>::iterator >& range = cursor.GetRange< typename std::set<T>::iterator >();
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<T *>(&*range.m_Current) ) : cursor.SetEnd();
+}
+
+template <class T>
+bool Helium::Reflect::SimpleStlSetTranslator<T>::Next( ContainerCursor& cursor ) const
+{
+	HELIUM_ASSERT( cursor.IsValid() );
+
+	ContainerCursor::Range< typename std::set<T>::iterator >& range = cursor.GetRange< typename std::set<T>::iterator >();
+	++range.m_Current;
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<T *>(&*range.m_Current) ) : cursor.SetEnd();
+}
+
 template <class T>
 Helium::Reflect::Translator* Helium::Reflect::SimpleStlSetTranslator<T>::GetItemTranslator() const
 {
@@ -435,6 +526,22 @@ void Helium::Reflect::SimpleStlMapTranslator<KeyT, ValueT>::Copy( Pointer src, P
 	}
 }
 
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlMapTranslator<KeyT, ValueT>::Move( Pointer src, Pointer dest )
+{
+	if ( src.m_Address != dest.m_Address )
+	{
+		dest.As< std::map<KeyT, ValueT> >().swap( src.As< std::map<KeyT, ValueT> >() );
+		src.As< std::map<KeyT, ValueT> >().clear();
+	}
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlMapTranslator<KeyT, ValueT>::Swap( Pointer a, Pointer b )
+{
+	a.As< std::map<KeyT, ValueT> >().swap( b.As< std::map<KeyT, ValueT> >() );
+}
+
 template <class KeyT, class ValueT>
 bool Helium::Reflect::SimpleStlMapTranslator<KeyT, ValueT>::Equals( Pointer a, Pointer b ) 
 {
@@ -455,6 +562,32 @@ void Helium::Reflect::SimpleStlMapTranslator<KeyT, ValueT>::Clear( Pointer conta
 	return m.clear();
 }
 
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlMapTranslator<KeyT, ValueT>::Reserve( Pointer container, size_t capacity )
+{
+	// node based, nothing to preallocate
+}
+
+template <class KeyT, class ValueT>
+bool Helium::Reflect::SimpleStlMapTranslator<KeyT, ValueT>::Begin( Pointer container, ContainerCursor& cursor ) const
+{
+	std::map<KeyT, ValueT> &c = container.As< std::map<KeyT, ValueT> >();
+	cursor.Reset( container, c.begin(), c.end() );
+
+	ContainerCursor::Range< typename std::map<KeyT, ValueT>::iterator >& range = cursor.GetRange< typename std::map<KeyT, ValueT>::iterator >();
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<KeyT *>(&range.m_Current->first), &range.m_Current->second ) : cursor.SetEnd();
+}
+
+template <class KeyT, class ValueT>
+bool Helium::Reflect::SimpleStlMapTranslator<KeyT, ValueT>::Next( ContainerCursor& cursor ) const
+{
+	HELIUM_ASSERT( cursor.IsValid() );
+
+	ContainerCursor::Range< typename std::map<KeyT, ValueT>::iterator >& range = cursor.GetRange< typename std::map<KeyT, ValueT>::iterator >();
+	++range.m_Current;
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<KeyT *>(&range.m_Current->first), &range.m_Current->second ) : cursor.SetEnd();
+}
+
 template <class KeyT, class ValueT>
 Helium::Reflect::ScalarTranslator* Helium::Reflect::SimpleStlMapTranslator<KeyT, ValueT>::GetKeyTranslator() const
 {
@@ -493,6 +626,13 @@ void Helium::Reflect::SimpleStlMapTranslator<KeyT, ValueT>::SetItem( Pointer ass
 	m[key.As<KeyT>()] = value.As<ValueT>();
 }
 
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlMapTranslator<KeyT, ValueT>::SetItemByMove( Pointer association, Pointer key, Pointer value )
+{
+	std::map<KeyT, ValueT> &m = association.As< std::map<KeyT, ValueT> >();
+	m_InternalTranslatorValue->Move(value, Pointer(&m[key.As<KeyT>()], association.m_Field, association.m_Object));
+}
+
 template <class KeyT, class ValueT>
 void Helium::Reflect::SimpleStlMapTranslator<KeyT, ValueT>::RemoveItem( Pointer association, Pointer key )
 {
@@ -512,3 +652,346 @@ void Helium::Reflect::SimpleStlMapTranslator<KeyT, ValueT>::RemoveItem( Pointer
 		m.erase(iter);
 	}
 }
+
+//////////////////////////////////////////////////////////////////////////
+
+template <class T>
+Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::SimpleStlUnorderedSetTranslator()
+	: SetTranslator(sizeof(std::unordered_set<T>))
+	, m_InternalTranslator(AllocateTranslator<T>())
+{
+
+}
+
+template <class T>
+Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::~SimpleStlUnorderedSetTranslator()
+{
+	delete m_InternalTranslator;
+}
+
+template <class T>
+void Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::Construct( Pointer pointer )
+{
+	DefaultConstruct< std::unordered_set<T> >(pointer);
+}
+
+template <class T>
+void Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::Destruct( Pointer pointer )
+{
+	DefaultDestruct< std::unordered_set<T> >(pointer);
+}
+
+template <class T>
+void Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::Copy( Pointer src, Pointer dest, uint32_t flags /*= 0 */ )
+{
+	if (flags & CopyFlags::Shallow)
+	{
+		DefaultCopy< std::unordered_set< T > >(src, dest, flags);
+		return;
+	}
+
+	std::unordered_set<T> &s_src = src.As< std::unordered_set<T> >();
+	std::unordered_set<T> &s_dest = dest.As< std::unordered_set<T> >();
+
+	s_dest.clear();
+	s_dest.reserve(s_src.size());
+
+	for ( typename std::unordered_set<T>::iterator iter_src = s_src.begin(); iter_src != s_src.end(); ++iter_src)
+	{
+		// Should be safe since we copy FROM this. Should not break const-ness (might increase a ref count or something like that though)
+		Pointer dp_src(const_cast<T *>(&*iter_src), src.m_Field, src.m_Object);
+		T temp;
+		Pointer dp_dest(&temp, dest.m_Field, dest.m_Object);
+		m_InternalTranslator->Copy(dp_src, dp_dest, flags);
+		s_dest.insert(temp);
+	}
+}
+
+template <class T>
+void Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::Move( Pointer src, Pointer dest )
+{
+	if ( src.m_Address != dest.m_Address )
+	{
+		dest.As< std::unordered_set<T> >().swap( src.As< std::unordered_set<T> >() );
+		src.As< std::unordered_set<T> >().clear();
+	}
+}
+
+template <class T>
+void Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::Swap( Pointer a, Pointer b )
+{
+	a.As< std::unordered_set<T> >().swap( b.As< std::unordered_set<T> >() );
+}
+
+template <class T>
+bool Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::Equals( Pointer a, Pointer b )
+{
+	return DefaultEquals< std::unordered_set<T> >(a, b);
+}
+
+template <class T>
+size_t Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::GetLength( Pointer container ) const
+{
+	std::unordered_set<T> &s = container.As< std::unordered_set<T> >();
+	return s.size();
+}
+
+template <class T>
+void Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::Clear( Pointer container )
+{
+	std::unordered_set<T> &s = container.As< std::unordered_set<T> >();
+	s.clear();
+}
+
+template <class T>
+void Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::Reserve( Pointer container, size_t capacity )
+{
+	std::unordered_set<T> &v = container.As< std::unordered_set<T> >();
+	v.reserve(capacity);
+}
+
+template <class T>
+bool Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::Begin( Pointer container, ContainerCursor& cursor ) const
+{
+	std::unordered_set<T> &c = container.As< std::unordered_set<T> >();
+	cursor.Reset( container, c.begin(), c.end() );
+
+	ContainerCursor::Range< typename std::unordered_set<T>::iterator >& range = cursor.GetRange< typename std::unordered_set<T>::iterator >();
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<T *>(&*range.m_Current) ) : cursor.SetEnd();
+}
+
+template <class T>
+bool Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::Next( ContainerCursor& cursor ) const
+{
+	HELIUM_ASSERT( cursor.IsValid() );
+
+	ContainerCursor::Range< typename std::unordered_set<T>::iterator >& range = cursor.GetRange< typename std::unordered_set<T>::iterator >();
+	++range.m_Current;
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<T *>(&*range.m_Current) ) : cursor.SetEnd();
+}
+
+template <class T>
+Helium::Reflect::Translator* Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::GetItemTranslator() const
+{
+	return m_InternalTranslator;
+}
+
+template <class T>
+void Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::GetItems( Pointer set, DynamicArray< Pointer >& items ) const
+{
+	std::unordered_set<T> &v = set.As< std::unordered_set<T> >();
+	items.Reserve(v.size());
+
+	for ( typename std::unordered_set<T>::iterator iter = v.begin(); iter != v.end(); ++iter )
+	{
+		// This is dangerous.. callers could modify values passed out
+		Pointer dp(const_cast<T *>(&*iter), set.m_Field, set.m_Object);
+		items.Add(dp);
+	}
+}
+
+template <class T>
+void Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::InsertItem( Pointer set, Pointer item )
+{
+	std::unordered_set<T> &v = set.As< std::unordered_set<T> >();
+	v.insert( typename std::unordered_set<T>::value_type(item.As<T>()) );
+}
+
+template <class T>
+void Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::RemoveItem( Pointer set, Pointer item )
+{
+	std::unordered_set<T> &v = set.As< std::unordered_set<T> >();
+	v.erase( typename std::unordered_set<T>::value_type(item.As<T>()) );
+}
+
+template <class T>
+bool Helium::Reflect::SimpleStlUnorderedSetTranslator<T>::ContainsItem( Pointer set, Pointer item ) const
+{
+	std::unordered_set<T> &s = set.As< std::unordered_set<T> >();
+
+	typename std::unordered_set<T>::iterator iter = s.find(item.As<T>());
+	return iter != s.end();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+template <class KeyT, class ValueT>
+Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::SimpleStlUnorderedMapTranslator()
+	: AssociationTranslator(sizeof(std::unordered_map<KeyT, ValueT>))
+	, m_InternalTranslatorKey(ReflectionCast< ScalarTranslator >( AllocateTranslator<KeyT>() ))
+	, m_InternalTranslatorValue(AllocateTranslator<ValueT>())
+{
+	HELIUM_ASSERT( m_InternalTranslatorKey );
+}
+
+template <class KeyT, class ValueT>
+Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::~SimpleStlUnorderedMapTranslator()
+{
+	delete m_InternalTranslatorKey;
+	delete m_InternalTranslatorValue;
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::Construct( Pointer pointer ) 
+{
+	DefaultConstruct< std::unordered_map<KeyT, ValueT> >(pointer);
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::Destruct( Pointer pointer ) 
+{
+	DefaultDestruct< std::unordered_map<KeyT, ValueT> >(pointer);
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::Copy( Pointer src, Pointer dest, uint32_t flags /*= 0 */ ) 
+{
+	if (flags & CopyFlags::Shallow)
+	{
+		DefaultCopy< std::unordered_map< KeyT, ValueT > >(src, dest, flags);
+		return;
+	}
+
+	std::unordered_map<KeyT, ValueT> &m_src = src.As< std::unordered_map<KeyT, ValueT> >();
+	std::unordered_map<KeyT, ValueT> &m_dest = dest.As< std::unordered_map<KeyT, ValueT> >();
+
+	m_dest.clear();
+	m_dest.reserve(m_src.size());
+
+	for ( typename std::unordered_map<KeyT, ValueT>::iterator iter_src = m_src.begin(); iter_src != m_src.end(); ++iter_src )
+	{
+		// Should be safe since we copy FROM this. Should not break const-ness (might increase a ref count or something like that though)
+		Pointer dp_src_key(const_cast<KeyT *>(&iter_src->first), src.m_Field, src.m_Object);
+		Pointer dp_src_value(&iter_src->second, src.m_Field, src.m_Object);
+
+		typename std::unordered_map<KeyT, ValueT>::value_type temp;
+
+		Pointer dp_dest_key(const_cast<KeyT *>(&temp.first), dest.m_Field, dest.m_Object);
+		Pointer dp_dest_value(&temp.second, dest.m_Field, dest.m_Object);
+
+		m_InternalTranslatorKey->Copy(dp_src_key, dp_dest_key, flags);
+		m_InternalTranslatorValue->Copy(dp_src_value, dp_dest_value, flags);
+
+		m_dest.insert(temp);
+	}
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::Move( Pointer src, Pointer dest )
+{
+	if ( src.m_Address != dest.m_Address )
+	{
+		dest.As< std::unordered_map<KeyT, ValueT> >().swap( src.As< std::unordered_map<KeyT, ValueT> >() );
+		src.As< std::unordered_map<KeyT, ValueT> >().clear();
+	}
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::Swap( Pointer a, Pointer b )
+{
+	a.As< std::unordered_map<KeyT, ValueT> >().swap( b.As< std::unordered_map<KeyT, ValueT> >() );
+}
+
+template <class KeyT, class ValueT>
+bool Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::Equals( Pointer a, Pointer b ) 
+{
+	return DefaultEquals< std::unordered_map< KeyT, ValueT > >(a, b);
+}
+
+template <class KeyT, class ValueT>
+size_t Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::GetLength( Pointer container ) const 
+{
+	std::unordered_map<KeyT, ValueT> &m = container.As< std::unordered_map<KeyT, ValueT> >();
+	return m.size();
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::Clear( Pointer container ) 
+{
+	std::unordered_map<KeyT, ValueT> &m = container.As< std::unordered_map<KeyT, ValueT> >();
+	return m.clear();
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::Reserve( Pointer container, size_t capacity )
+{
+	std::unordered_map<KeyT, ValueT> &v = container.As< std::unordered_map<KeyT, ValueT> >();
+	v.reserve(capacity);
+}
+
+template <class KeyT, class ValueT>
+bool Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::Begin( Pointer container, ContainerCursor& cursor ) const
+{
+	std::unordered_map<KeyT, ValueT> &c = container.As< std::unordered_map<KeyT, ValueT> >();
+	cursor.Reset( container, c.begin(), c.end() );
+
+	ContainerCursor::Range< typename std::unordered_map<KeyT, ValueT>::iterator >& range = cursor.GetRange< typename std::unordered_map<KeyT, ValueT>::iterator >();
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<KeyT *>(&range.m_Current->first), &range.m_Current->second ) : cursor.SetEnd();
+}
+
+template <class KeyT, class ValueT>
+bool Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::Next( ContainerCursor& cursor ) const
+{
+	HELIUM_ASSERT( cursor.IsValid() );
+
+	ContainerCursor::Range< typename std::unordered_map<KeyT, ValueT>::iterator >& range = cursor.GetRange< typename std::unordered_map<KeyT, ValueT>::iterator >();
+	++range.m_Current;
+	return range.m_Current != range.m_End ? cursor.SetCurrent( const_cast<KeyT *>(&range.m_Current->first), &range.m_Current->second ) : cursor.SetEnd();
+}
+
+template <class KeyT, class ValueT>
+Helium::Reflect::ScalarTranslator* Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::GetKeyTranslator() const
+{
+	return m_InternalTranslatorKey;
+}
+
+template <class KeyT, class ValueT>
+Helium::Reflect::Translator* Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::GetValueTranslator() const
+{
+	return m_InternalTranslatorValue;
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::GetItems( Pointer association, DynamicArray<Pointer>& keys, DynamicArray<Pointer>& values )
+{
+	std::unordered_map<KeyT, ValueT> &m = association.As< std::unordered_map<KeyT, ValueT> >();
+
+	for ( typename std::unordered_map<KeyT, ValueT>::iterator iter = m.begin(); iter != m.end(); ++iter )
+	{
+		keys.Add(Pointer(const_cast<KeyT *>(&iter->first), association.m_Field, association.m_Object));
+		values.Add(Pointer(&iter->second, association.m_Field, association.m_Object));
+	}
+}
+
+template <class KeyT, class ValueT>
+Helium::Reflect::Pointer Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::GetItem( Pointer association, Pointer key )
+{
+	std::unordered_map<KeyT, ValueT> &m = association.As< std::unordered_map<KeyT, ValueT> >();
+	return Pointer(&m[key.As<KeyT>()], association.m_Field, association.m_Object);
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::SetItem( Pointer association, Pointer key, Pointer value )
+{
+	std::unordered_map<KeyT, ValueT> &m = association.As< std::unordered_map<KeyT, ValueT> >();
+	m[key.As<KeyT>()] = value.As<ValueT>();
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::SetItemByMove( Pointer association, Pointer key, Pointer value )
+{
+	std::unordered_map<KeyT, ValueT> &m = association.As< std::unordered_map<KeyT, ValueT> >();
+	m_InternalTranslatorValue->Move(value, Pointer(&m[key.As<KeyT>()], association.m_Field, association.m_Object));
+}
+
+template <class KeyT, class ValueT>
+void Helium::Reflect::SimpleStlUnorderedMapTranslator<KeyT, ValueT>::RemoveItem( Pointer association, Pointer key )
+{
+	std::unordered_map<KeyT, ValueT> &m = association.As< std::unordered_map<KeyT, ValueT> >();
+	typename std::unordered_map<KeyT, ValueT>::iterator iter = m.find(key.As<KeyT>());
+
+	if (iter != m.end())
+	{
+		m.erase(iter);
+	}
+}
@@ -1,12 +1,78 @@
 #include "ReflectPch.h"
 #include "Translator.h"
 
+#include "Platform/Atomic.h"
+#include "Platform/Thread.h"
+
 #include "Reflect/Object.h"
 #include "Reflect/MetaStruct.h"
 
 using namespace Helium;
 using namespace Helium::Reflect;
 
+// variable storage too big to be inline is pooled per thread in power of two size classes (128 bytes to 4k)
+static const size_t   VariablePoolMinimumShift = 7;
+static const size_t   VariablePoolSizeClasses = 6;
+static const uint32_t VariablePoolMaximumFree = 8;
+
+struct VariablePoolBlock
+{
+	VariablePoolBlock* m_Next;
+};
+
+struct VariablePool
+{
+	VariablePoolBlock* m_Free[ VariablePoolSizeClasses ];
+	uint32_t           m_FreeCount[ VariablePoolSizeClasses ];
+};
+
+static volatile int32_t   g_VariableHeapAllocations = 0;
+
+static void FreeVariablePool( VariablePool* pool )
+{
+	DefaultAllocator allocator;
+	for ( size_t sizeClass=0; sizeClass<VariablePoolSizeClasses; ++sizeClass )
+	{
+		while ( VariablePoolBlock* block = pool->m_Free[ sizeClass ] )
+		{
+			pool->m_Free[ sizeClass ] = block->m_Next;
+			allocator.FreeAligned( block );
+		}
+	}
+
+	delete pool;
+}
+
+static void FreeVariablePoolAtThreadExit( void* pool )
+{
+	FreeVariablePool( static_cast< VariablePool* >( pool ) );
+}
+
+// the pool of each thread, freed when the thread exits (or calls Variable::ReleaseThreadPool)
+static ThreadLocalPointer g_VariablePool ( &FreeVariablePoolAtThreadExit );
+
+static size_t GetVariableSizeClass( size_t size )
+{
+	size_t sizeClass = 0;
+	while ( ( static_cast< size_t >( 1 ) << ( VariablePoolMinimumShift + sizeClass ) ) < size )
+	{
+		++sizeClass;
+	}
+	return sizeClass;
+}
+
+static VariablePool* GetVariablePool()
+{
+	VariablePool* pool = static_cast< VariablePool* >( g_VariablePool.GetPointer() );
+	if ( !pool )
+	{
+		pool = new VariablePool;
+		MemoryZero( pool, sizeof( VariablePool ) );
+		g_VariablePool.SetPointer( pool );
+	}
+	return pool;
+}
+
 Pointer::Pointer()
 	: m_Address( 0x0 )
 	, m_Field( 0 )
@@ -55,7 +121,132 @@ void Pointer::RaiseChanged( bool doIt )
 	}
 }
 
+int32_t Variable::GetHeapAllocationCount()
+{
+	return g_VariableHeapAllocations;
+}
+
+void Variable::ReleaseThreadPool()
+{
+	VariablePool* pool = static_cast< VariablePool* >( g_VariablePool.GetPointer() );
+	if ( pool )
+	{
+		g_VariablePool.SetPointer( NULL );
+		FreeVariablePool( pool );
+	}
+}
+
+void* Variable::Allocate( size_t size )
+{
+	size_t sizeClass = GetVariableSizeClass( size );
+	if ( sizeClass < VariablePoolSizeClasses )
+	{
+		VariablePool* pool = GetVariablePool();
+		VariablePoolBlock* block = pool->m_Free[ sizeClass ];
+		if ( block )
+		{
+			pool->m_Free[ sizeClass ] = block->m_Next;
+			--pool->m_FreeCount[ sizeClass ];
+			return block;
+		}
+
+		size = static_cast< size_t >( 1 ) << ( VariablePoolMinimumShift + sizeClass );
+	}
+
+	AtomicIncrementUnsafe( g_VariableHeapAllocations );
+
+	DefaultAllocator allocator;
+	return allocator.AllocateAligned( HELIUM_SIMD_ALIGNMENT, size );
+}
+
+void Variable::Free( void* memory, size_t size )
+{
+	size_t sizeClass = GetVariableSizeClass( size );
+	if ( sizeClass < VariablePoolSizeClasses )
+	{
+		VariablePool* pool = GetVariablePool();
+		if ( pool->m_FreeCount[ sizeClass ] < VariablePoolMaximumFree )
+		{
+			VariablePoolBlock* block = static_cast< VariablePoolBlock* >( memory );
+			block->m_Next = pool->m_Free[ sizeClass ];
+			pool->m_Free[ sizeClass ] = block;
+			++pool->m_FreeCount[ sizeClass ];
+			return;
+		}
+	}
+
+	DefaultAllocator allocator;
+	allocator.FreeAligned( memory );
+}
+
 uint32_t Translator::GetDefaultFlags()
 {
 	return 0x0;
 }
+
+static void InitializeOrder( size_t length, DynamicArray< size_t >& order )
+{
+	order.Resize( length );
+	for ( size_t i=0; i<length; ++i )
+	{
+		order[ i ] = i;
+	}
+}
+
+bool SequenceTranslator::GetMoveUpOrder( size_t length, const Set< size_t >& items, DynamicArray< size_t >& order )
+{
+	InitializeOrder( length, order );
+
+	bool moved = false;
+	for ( Set< size_t >::ConstIterator itr = items.Begin(), end = items.End(); itr != end; ++itr )
+	{
+		size_t index = *itr;
+		if ( index > 0 && index < length )
+		{
+			Helium::Swap( order[ index ], order[ index - 1 ] );
+			moved = true;
+		}
+	}
+
+	return moved;
+}
+
+void SequenceTranslator::SwapIntoOrder( Pointer sequence, const DynamicArray< size_t >& order )
+{
+	Translator* itemTranslator = GetItemTranslator();
+
+	DynamicArray< uint8_t > placed;
+	placed.Add( 0, order.GetSize() );
+
+	for ( size_t start=0; start<order.GetSize(); ++start )
+	{
+		// each swap settles the item at index, whose old item moves on to where the cycle wants it
+		size_t index = start;
+		while ( !placed[ index ] && order[ index ] != start )
+		{
+			HELIUM_ASSERT( order[ index ] < order.GetSize() );
+			itemTranslator->Swap( GetItem( sequence, index ), GetItem( sequence, order[ index ] ) );
+			placed[ index ] = 1;
+			index = order[ index ];
+		}
+		placed[ index ] = 1;
+	}
+}
+
+bool SequenceTranslator::GetMoveDownOrder( size_t length, const Set< size_t >& items, DynamicArray< size_t >& order )
+{
+	InitializeOrder( length, order );
+
+	bool moved = false;
+	for ( Set< size_t >::ConstIterator itr = items.End(), begin = items.Begin(); itr != begin; )
+	{
+		size_t index = *--itr;
+		if ( index + 1 < length )
+		{
+			Helium::Swap( order[ index ], order[ index + 1 ] );
+			moved = true;
+		}
+	}
+
+	return moved;
+}
@@ -43,6 +43,7 @@ namespace Helium
 
 		//
 		// Variables are a Pointer that allocate its own instance of the Translated data type
+		//  small types are stored inside the variable, larger ones come from a per-thread pool
 		//
 
 		class HELIUM_REFLECT_API Variable : public Pointer, NonCopyable
@@ -51,7 +52,20 @@ namespace Helium
 			inline Variable( Translator* translator );
 			inline ~Variable();
 
+			// number of heap allocations made for variable storage (pool misses and oversized types)
+			static int32_t GetHeapAllocationCount();
+
+			// free the storage pooled by the calling thread now (it's freed when the thread exits otherwise)
+			static void ReleaseThreadPool();
+
 			Translator* m_Translator;
+
+		private:
+			static void* Allocate( size_t size );
+			static void  Free( void* memory, size_t size );
+
+			static const size_t InlineSize = 64;
+			HELIUM_ALIGN_PRE( HELIUM_SIMD_ALIGNMENT ) uint8_t m_Storage[ InlineSize ] HELIUM_ALIGN_POST( HELIUM_SIMD_ALIGNMENT );
 		};
 
 		//
@@ -99,6 +113,7 @@ namespace Helium
 			template< class T > HELIUM_FORCEINLINE void DefaultDestruct( Pointer pointer );
 			template< class T > HELIUM_FORCEINLINE void DefaultCopy( Pointer src, Pointer dest, uint32_t flags );
 			template< class T > HELIUM_FORCEINLINE bool DefaultEquals( Pointer a, Pointer b );
+			template< class T > HELIUM_FORCEINLINE void DefaultSwap( Pointer a, Pointer b );
 
 			// call the constructor (in-place)
 			virtual void Construct( Pointer pointer ) = 0;
@@ -109,6 +124,12 @@ namespace Helium
 			// copies value from one instance to another
 			virtual void Copy( Pointer src, Pointer dest, uint32_t flags = 0 ) = 0;
 
+			// moves value from one instance to another, containers, std::string and pointers are left empty (other values are copied)
+			virtual void Move( Pointer src, Pointer dest ) = 0;
+
+			// exchanges values between instances
+			virtual void Swap( Pointer a, Pointer b ) = 0;
+
 			// tests for equivalence across instances
 			virtual bool Equals( Pointer a, Pointer b ) = 0;
 
@@ -173,6 +194,56 @@ namespace Helium
 			virtual const MetaStruct* GetMetaStruct() const = 0;
 		};
 
+		//
+		// Forward iteration state for container data, owns the iterator of the container being walked
+		//
+
+		class HELIUM_REFLECT_API ContainerCursor : NonCopyable
+		{
+		public:
+			inline ContainerCursor();
+			inline ~ContainerCursor();
+
+			// a range of native iterators, stored in place inside the cursor
+			template< class IteratorT >
+			struct Range
+			{
+				inline Range( IteratorT current, IteratorT end );
+
+				IteratorT m_Current;
+				IteratorT m_End;
+			};
+
+			// does the cursor reference an item
+			inline bool IsValid() const;
+
+			// start iterating over a container, called by translators
+			template< class IteratorT > void Reset( Pointer container, IteratorT begin, IteratorT end );
+			template< class IteratorT > Range< IteratorT >& GetRange();
+
+			// point at the current item (and value, for associations), or flag the end of the container
+			inline bool SetCurrent( void* item, void* value = NULL );
+			inline bool SetEnd();
+
+			Pointer m_Container; // the container being iterated
+			Pointer m_Item;      // the current item (or key, for associations)
+			Pointer m_Value;     // the current value (associations only)
+
+		private:
+			typedef void (*DestructRangeFunc)( void* range );
+			template< class IteratorT > static void DestroyRange( void* range );
+			inline void DestructRange();
+
+			union
+			{
+				void*    m_AlignPointer;
+				uint64_t m_AlignInteger;
+				uint8_t  m_Storage[ 8 * sizeof( void* ) ];
+			};
+			DestructRangeFunc m_DestructRange;
+			bool              m_Valid;
+		};
+
 		//
 		// Polymorphic access to container data
 		//
@@ -186,6 +257,13 @@ namespace Helium
 
 			virtual size_t GetLength( Pointer container ) const = 0;
 			virtual void   Clear( Pointer container ) = 0;
+
+			// preallocate storage for the given number of items, where the container supports it
+			virtual void   Reserve( Pointer container, size_t capacity ) = 0;
+
+			// walk the items in place without allocating, returns false once there are no more items
+			virtual bool   Begin( Pointer container, ContainerCursor& cursor ) const = 0;
+			virtual bool   Next( ContainerCursor& cursor ) const = 0;
 		};
 
 		//
@@ -227,9 +305,27 @@ namespace Helium
 			virtual Pointer     GetItem( Pointer sequence, size_t at ) = 0;
 			virtual void        SetItem( Pointer sequence, size_t at, Pointer value ) = 0;
 			virtual void        Insert( Pointer sequence, size_t at, Pointer value ) = 0;
+			virtual void        SetItemByMove( Pointer sequence, size_t at, Pointer value ) = 0;
+			virtual void        InsertByMove( Pointer sequence, size_t at, Pointer value ) = 0;
 			virtual void        Remove( Pointer sequence, size_t at ) = 0;
 			virtual void        MoveUp( Pointer sequence, Set< size_t >& items ) = 0;
 			virtual void        MoveDown( Pointer sequence, Set< size_t >& items ) = 0;
+
+			// bulk operations, values points to count contiguous items of the native item type
+			virtual void        AppendRange( Pointer sequence, Pointer values, size_t count ) = 0;
+			virtual void        InsertRange( Pointer sequence, size_t at, Pointer values, size_t count ) = 0;
+			virtual void        RemoveRange( Pointer sequence, size_t at, size_t count ) = 0;
+
+			// rearrange all items in one pass, the item at order[ i ] moves to index i
+			virtual void        Reorder( Pointer sequence, const DynamicArray< size_t >& order ) = 0;
+
+		protected:
+			// compute the order that moves each of the items one slot towards the front (or back), false if nothing moves
+			static bool         GetMoveUpOrder( size_t length, const Set< size_t >& items, DynamicArray< size_t >& order );
+			static bool         GetMoveDownOrder( size_t length, const Set< size_t >& items, DynamicArray< size_t >& order );
+
+			// apply an order in place by swapping items around each cycle of it, so no item is copied
+			void                SwapIntoOrder( Pointer sequence, const DynamicArray< size_t >& order );
 		};
 
 		//
@@ -250,6 +346,7 @@ namespace Helium
 
 			virtual Pointer           GetItem( Pointer association, Pointer key ) = 0;
 			virtual void              SetItem( Pointer association, Pointer key, Pointer value ) = 0;
+			virtual void              SetItemByMove( Pointer association, Pointer key, Pointer value ) = 0;
 			virtual void              RemoveItem( Pointer association, Pointer key ) = 0;
 		};
 
@@ -7,14 +7,17 @@ T& Helium::Reflect::Pointer::As()
 Helium::Reflect::Variable::Variable( Translator* translator )
 	: m_Translator( translator )
 {
-	m_Address = new unsigned char[ m_Translator->m_Size ];
+	m_Address = m_Translator->m_Size <= InlineSize ? m_Storage : Allocate( m_Translator->m_Size );
 	m_Translator->Construct( *this );
 }
 
 Helium::Reflect::Variable::~Variable()
 {
 	m_Translator->Destruct( *this );
-	delete[] static_cast< char* >( m_Address );
+	if ( m_Address != m_Storage )
+	{
+		Free( m_Address, m_Translator->m_Size );
+	}
 }
 
 Helium::Reflect::Data::Data( Pointer pointer, Translator* translator )
@@ -74,6 +77,13 @@ bool Helium::Reflect::Translator::DefaultEquals( Pointer a, Pointer b )
 	return left == right;
 }
 
+template< class T >
+void Helium::Reflect::Translator::DefaultSwap( Pointer a, Pointer b )
+{
+	HELIUM_ASSERT( !a.m_Field || !b.m_Field || a.m_Field == b.m_Field );
+	Helium::Swap( a.As<T>(), b.As<T>() );
+}
+
 Helium::Reflect::Translator::Translator( size_t size )
 	: m_Size( size )
 {
@@ -107,6 +117,82 @@ Helium::Reflect::StructureTranslator::StructureTranslator( size_t size )
 
 }
 
+Helium::Reflect::ContainerCursor::ContainerCursor()
+	: m_DestructRange( NULL )
+	, m_Valid( false )
+{
+}
+
+Helium::Reflect::ContainerCursor::~ContainerCursor()
+{
+	DestructRange();
+}
+
+template< class IteratorT >
+Helium::Reflect::ContainerCursor::Range< IteratorT >::Range( IteratorT current, IteratorT end )
+	: m_Current( current )
+	, m_End( end )
+{
+}
+
+bool Helium::Reflect::ContainerCursor::IsValid() const
+{
+	return m_Valid;
+}
+
+template< class IteratorT >
+void Helium::Reflect::ContainerCursor::Reset( Pointer container, IteratorT begin, IteratorT end )
+{
+	HELIUM_COMPILE_ASSERT( sizeof( Range< IteratorT > ) <= sizeof( m_Storage ) );
+
+	DestructRange();
+	new ( m_Storage ) Range< IteratorT >( begin, end );
+	m_DestructRange = &DestroyRange< IteratorT >;
+
+	m_Container = container;
+	m_Item = Pointer();
+	m_Value = Pointer();
+	m_Valid = false;
+}
+
+template< class IteratorT >
+Helium::Reflect::ContainerCursor::Range< IteratorT >& Helium::Reflect::ContainerCursor::GetRange()
+{
+	HELIUM_ASSERT( m_DestructRange == &DestroyRange< IteratorT > );
+	return *reinterpret_cast< Range< IteratorT >* >( m_Storage );
+}
+
+bool Helium::Reflect::ContainerCursor::SetCurrent( void* item, void* value )
+{
+	m_Item = Pointer( item, m_Container.m_Field, m_Container.m_Object );
+	m_Value = Pointer( value, m_Container.m_Field, m_Container.m_Object );
+	m_Valid = true;
+	return true;
+}
+
+bool Helium::Reflect::ContainerCursor::SetEnd()
+{
+	m_Item = Pointer();
+	m_Value = Pointer();
+	m_Valid = false;
+	return false;
+}
+
+template< class IteratorT >
+void Helium::Reflect::ContainerCursor::DestroyRange( void* range )
+{
+	static_cast< Range< IteratorT >* >( range )->~Range< IteratorT >();
+}
+
+void Helium::Reflect::ContainerCursor::DestructRange()
+{
+	if ( m_DestructRange )
+	{
+		m_DestructRange( m_Storage );
+		m_DestructRange = NULL;
+	}
+}
+
 Helium::Reflect::ContainerTranslator::ContainerTranslator( size_t size )
 	: Translator(size)
 {